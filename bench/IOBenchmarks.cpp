@@ -0,0 +1,59 @@
+#include "IO/CsvReader.hpp"
+#include "Server/ServerProtocol.hpp"
+#include <benchmark/benchmark.h>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+
+using namespace FusioCore;
+
+namespace {
+
+// Fichier CSV de rows lignes et 8 colonnes (en-tête, valeurs aléatoires)
+std::string writeCsv(long rows) {
+    const std::string path = (std::filesystem::temp_directory_path() /
+                              ("fusiocore_bench_" + std::to_string(rows) + ".csv")).string();
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    std::mt19937_64 random(42);
+    std::uniform_real_distribution<double> distribution(-1000.0, 1000.0);
+    file << "a,b,c,d,e,f,g,h\n";
+    char buffer[32];
+    for (long i = 0; i < rows; ++i) {
+        for (int j = 0; j < 8; ++j) {
+            std::snprintf(buffer, sizeof(buffer), "%.6f", distribution(random));
+            file << buffer << (j < 7 ? ',' : '\n');
+        }
+    }
+    return path;
+}
+
+void BM_ReadCsv(benchmark::State& state) {
+    const std::string path = writeCsv(state.range(0));
+    CsvStats stats;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(CsvReader::read(path, stats));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * stats.bytes));
+    std::remove(path.c_str());
+}
+BENCHMARK(BM_ReadCsv)->Arg(1 << 10)->Arg(1 << 18)->Unit(benchmark::kMillisecond);
+
+// Réponse binaire du serveur : copie des éléments dans le tampon de sortie
+void BM_ServerEncodeMatrix(benchmark::State& state) {
+    const Eigen::Index n = state.range(0);
+    const Value matrix = Matrix(Eigen::MatrixXd::Random(n, n));
+    std::string out;
+    for (auto _ : state) {
+        out.clear();
+        const size_t start = ServerProtocol::beginResponse(out, 1);
+        ServerProtocol::appendValue(out, matrix);
+        ServerProtocol::endResponse(out, start);
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * out.size()));
+}
+BENCHMARK(BM_ServerEncodeMatrix)->Arg(16)->Arg(512);
+
+} // namespace
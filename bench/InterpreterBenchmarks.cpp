@@ -0,0 +1,205 @@
+#include "Expression/BytecodeCompiler.hpp"
+#include "Expression/ExprTkEvaluator.hpp"
+#include "Expression/FusioInterpreter.hpp"
+#include "Expression/NativeEvaluator.hpp"
+#include "Expression/ProgramCache.hpp"
+#include "Expression/VirtualMachine.hpp"
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <string>
+
+using namespace FusioCore;
+
+namespace {
+
+const std::string SCALAR_EXPRESSION = "sin(x) * cos(y) + x^2 / (1 + y) - sqrt(abs(x - y))";
+
+void defineScalars(IExpressionEvaluator& evaluator) {
+    evaluator.setVariable("x", Scalar(0.75));
+    evaluator.setVariable("y", Scalar(-1.25));
+}
+
+// Littéral n x n : "[1 2 ...; ...]"
+std::string matrixLiteral(int n) {
+    std::string text = "[";
+    for (int i = 0; i < n; ++i) {
+        for (int j = 0; j < n; ++j) {
+            text += std::to_string(i * n + j) + (j + 1 < n ? " " : "");
+        }
+        text += i + 1 < n ? "; " : "]";
+    }
+    return text;
+}
+
+// ExprTk : compilation à chaque évaluation (cache vidé)
+void BM_ExprTkEvaluateCold(benchmark::State& state) {
+    ExprTkEvaluator evaluator;
+    defineScalars(evaluator);
+    for (auto _ : state) {
+        evaluator.clearCache();
+        benchmark::DoNotOptimize(evaluator.evaluate(SCALAR_EXPRESSION));
+    }
+}
+BENCHMARK(BM_ExprTkEvaluateCold);
+
+// ExprTk : expression répétée, servie par le cache
+void BM_ExprTkEvaluateRepeated(benchmark::State& state) {
+    ExprTkEvaluator evaluator;
+    defineScalars(evaluator);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(evaluator.evaluate(SCALAR_EXPRESSION));
+    }
+}
+BENCHMARK(BM_ExprTkEvaluateRepeated);
+
+// Évaluateur natif : même expression, servie par son cache d'instructions
+void BM_NativeEvaluateRepeated(benchmark::State& state) {
+    NativeEvaluator evaluator;
+    defineScalars(evaluator);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(evaluator.evaluate(SCALAR_EXPRESSION));
+    }
+}
+BENCHMARK(BM_NativeEvaluateRepeated);
+
+// Évaluateur natif sur des matrices : A*v est calculé une fois, 2*3 est replié
+void BM_NativeEvaluateMatrix(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    NativeEvaluator evaluator;
+    evaluator.setVariable("A", Matrix(Eigen::MatrixXd::Random(n, n)));
+    evaluator.setVariable("v", Vector(Eigen::VectorXd::Random(n)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(evaluator.evaluate("(A*v) .* (A*v) + 2*3*v"));
+    }
+}
+BENCHMARK(BM_NativeEvaluateMatrix)->Arg(4)->Arg(64)->Arg(512);
+
+// Formule évaluée ligne par ligne : affectation des variables puis évaluation
+void BM_ExprTkEvaluateRows(benchmark::State& state) {
+    const Eigen::Index rows = state.range(0);
+    const Eigen::VectorXd x = Eigen::VectorXd::Random(rows);
+    const Eigen::VectorXd y = Eigen::VectorXd::Random(rows);
+    ExprTkEvaluator evaluator;
+    for (auto _ : state) {
+        for (Eigen::Index i = 0; i < rows; ++i) {
+            evaluator.setVariable("x", Scalar(x[i]));
+            evaluator.setVariable("y", Scalar(y[i]));
+            benchmark::DoNotOptimize(evaluator.evaluate(SCALAR_EXPRESSION));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * rows);
+}
+BENCHMARK(BM_ExprTkEvaluateRows)->Arg(1 << 12)->Arg(1 << 16);
+
+// Même formule, compilée une fois et exécutée sur les colonnes
+void BM_EvaluateBatch(benchmark::State& state) {
+    const Eigen::Index rows = state.range(0);
+    const Eigen::VectorXd x = Eigen::VectorXd::Random(rows);
+    const Eigen::VectorXd y = Eigen::VectorXd::Random(rows);
+    ExprTkEvaluator evaluator;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(evaluator.evaluateBatch(SCALAR_EXPRESSION, {{"x", x}, {"y", y}}));
+    }
+    state.SetItemsProcessed(state.iterations() * rows);
+}
+BENCHMARK(BM_EvaluateBatch)->Arg(1 << 12)->Arg(1 << 16)->Arg(1 << 22);
+
+// Littéral : analyse, typage, compilation et exécution
+void BM_MatrixLiteralCold(benchmark::State& state) {
+    const std::string literal = matrixLiteral(static_cast<int>(state.range(0)));
+    ExprTkEvaluator evaluator;
+    BytecodeCompiler compiler(evaluator);
+    VirtualMachine machine(evaluator);
+    for (auto _ : state) {
+        auto program = compiler.compile(literal);
+        VirtualMachine::Frame frame;
+        benchmark::DoNotOptimize(machine.execute(*program, frame));
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(literal.size()));
+}
+BENCHMARK(BM_MatrixLiteralCold)->Arg(10)->Arg(50)->Arg(200);
+
+// Littéral réexécuté : programme conservé par le cache de l'interpréteur
+void BM_MatrixLiteralRepeated(benchmark::State& state) {
+    const std::string statement = "M = " + matrixLiteral(static_cast<int>(state.range(0)));
+    FusioInterpreter interpreter;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(interpreter.evaluate(statement));
+    }
+}
+BENCHMARK(BM_MatrixLiteralRepeated)->Arg(10)->Arg(50)->Arg(200);
+
+// Instructions typiques d'une boucle de script
+void BM_InterpreterScalarStatement(benchmark::State& state) {
+    FusioInterpreter interpreter;
+    interpreter.evaluate("k = 0");
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(interpreter.evaluate("k = k + 1"));
+    }
+}
+BENCHMARK(BM_InterpreterScalarStatement);
+
+void BM_InterpreterMatrixStatement(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    FusioInterpreter interpreter;
+    interpreter.setVariable("A", Matrix(Eigen::MatrixXd::Random(n, n)));
+    interpreter.setVariable("v", Vector(Eigen::VectorXd::Random(n)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(interpreter.evaluate("y = A*v + 2*v - sin(v)"));
+    }
+}
+BENCHMARK(BM_InterpreterMatrixStatement)->Arg(4)->Arg(64)->Arg(512);
+
+// Même instruction par les deux backends de l'interpréteur : bytecode (ExprTk)
+// ou évaluateur natif (A*v calculé une fois, 2*3 replié)
+void BM_InterpreterBackend(benchmark::State& state) {
+    const auto type = static_cast<EvaluatorType>(state.range(0));
+    const int n = static_cast<int>(state.range(1));
+    FusioInterpreter interpreter(std::make_shared<ProgramCache>(), type);
+    interpreter.setVariable("A", Matrix(Eigen::MatrixXd::Random(n, n)));
+    interpreter.setVariable("v", Vector(Eigen::VectorXd::Random(n)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(interpreter.evaluate("y = (A*v) .* (A*v) + 2*3*v"));
+    }
+    state.SetLabel(ExpressionEvaluatorFactory::typeName(type));
+}
+BENCHMARK(BM_InterpreterBackend)
+    ->ArgsProduct({{static_cast<int>(EvaluatorType::EXPRTK), static_cast<int>(EvaluatorType::NATIVE)}, {4, 64, 512}});
+
+// Copie d'une variable : les éléments sont partagés, le coût ne dépend pas de n
+void BM_InterpreterAssignCopy(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    FusioInterpreter interpreter;
+    interpreter.setVariable("A", Matrix(Eigen::MatrixXd::Random(n, n)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(interpreter.evaluate("B = A"));
+    }
+}
+BENCHMARK(BM_InterpreterAssignCopy)->Arg(4)->Arg(512)->Arg(2048);
+
+// Sous-matrice et transposée : vues sur les éléments, sans copie
+void BM_InterpreterSlice(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    FusioInterpreter interpreter;
+    interpreter.setVariable("A", Matrix(Eigen::MatrixXd::Random(n, n)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(interpreter.evaluate("B = A(1:end/2, :)"));
+        benchmark::DoNotOptimize(interpreter.evaluate("C = A'"));
+    }
+}
+BENCHMARK(BM_InterpreterSlice)->Arg(4)->Arg(512)->Arg(2048);
+
+// Une session par thread, programmes compilés partagés : le débit doit croître avec les threads
+void BM_InterpreterConcurrentSessions(benchmark::State& state) {
+    static const auto programs = std::make_shared<ProgramCache>();
+    FusioInterpreter session(programs);
+    session.setVariable("A", Matrix(Eigen::MatrixXd::Random(64, 64)));
+    session.setVariable("v", Vector(Eigen::VectorXd::Random(64)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(session.evaluate("y = A*v + 2*v - sin(v)"));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_InterpreterConcurrentSessions)->ThreadRange(1, 8)->UseRealTime();
+
+} // namespace
@@ -0,0 +1,232 @@
+#include "Value/SparseMatrix.hpp"
+#include "Value/Value.hpp"
+#include "Value/ValueFormatter.hpp"
+#include "Value/Variant.hpp"
+#include <benchmark/benchmark.h>
+#include <ostream>
+#include <vector>
+
+using namespace FusioCore;
+
+namespace {
+
+// Tailles n x n couvertes par les opérateurs de Matrix
+void matrixSizes(benchmark::internal::Benchmark* benchmark) {
+    for (int n : {4, 16, 64, 256}) {
+        benchmark->Arg(n);
+    }
+}
+
+Matrix randomMatrix(Eigen::Index n) {
+    return Matrix(Eigen::MatrixXd::Random(n, n));
+}
+
+void BM_MatrixAdd(benchmark::State& state) {
+    const Eigen::Index n = state.range(0);
+    Matrix a = randomMatrix(n);
+    Matrix b = randomMatrix(n);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a + b);
+    }
+    state.SetItemsProcessed(state.iterations() * n * n);
+}
+BENCHMARK(BM_MatrixAdd)->Apply(matrixSizes);
+
+void BM_MatrixScale(benchmark::State& state) {
+    const Eigen::Index n = state.range(0);
+    Matrix a = randomMatrix(n);
+    Scalar s(1.5);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a * s);
+    }
+    state.SetItemsProcessed(state.iterations() * n * n);
+}
+BENCHMARK(BM_MatrixScale)->Apply(matrixSizes);
+
+void BM_MatrixMultiply(benchmark::State& state) {
+    const Eigen::Index n = state.range(0);
+    Matrix a = randomMatrix(n);
+    Matrix b = randomMatrix(n);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a * b);
+    }
+    state.SetItemsProcessed(state.iterations() * 2 * n * n * n);
+}
+BENCHMARK(BM_MatrixMultiply)->Apply(matrixSizes);
+
+// Addition et produit dans chaque type d'éléments (range(1) : DType)
+void BM_MatrixAddTyped(benchmark::State& state) {
+    const Eigen::Index n = state.range(0);
+    const auto dtype = static_cast<DType>(state.range(1));
+    Matrix a = randomMatrix(n).astype(dtype);
+    Matrix b = randomMatrix(n).astype(dtype);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a + b);
+    }
+    state.SetItemsProcessed(state.iterations() * n * n);
+    state.SetLabel(dtypeName(dtype));
+}
+BENCHMARK(BM_MatrixAddTyped)->ArgsProduct({{256, 1024}, {static_cast<long>(DType::F32), static_cast<long>(DType::F64),
+                                                          static_cast<long>(DType::I32)}});
+
+void BM_MatrixMultiplyTyped(benchmark::State& state) {
+    const Eigen::Index n = state.range(0);
+    const auto dtype = static_cast<DType>(state.range(1));
+    Matrix a = randomMatrix(n).astype(dtype);
+    Matrix b = randomMatrix(n).astype(dtype);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a * b);
+    }
+    state.SetItemsProcessed(state.iterations() * 2 * n * n * n);
+    state.SetLabel(dtypeName(dtype));
+}
+BENCHMARK(BM_MatrixMultiplyTyped)->ArgsProduct({{64, 256}, {static_cast<long>(DType::F32), static_cast<long>(DType::F64)}});
+
+void BM_MatrixVector(benchmark::State& state) {
+    const Eigen::Index n = state.range(0);
+    Matrix a = randomMatrix(n);
+    Vector v(Eigen::VectorXd::Random(n));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a * v);
+    }
+    state.SetItemsProcessed(state.iterations() * 2 * n * n);
+}
+BENCHMARK(BM_MatrixVector)->Apply(matrixSizes);
+
+void BM_MatrixTranspose(benchmark::State& state) {
+    const Eigen::Index n = state.range(0);
+    Matrix a = randomMatrix(n);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a.transpose());
+    }
+    state.SetItemsProcessed(state.iterations() * n * n);
+}
+BENCHMARK(BM_MatrixTranspose)->Apply(matrixSizes);
+
+// Nouvelle valeur à chaque itération : la décomposition LU n'est pas réutilisée
+void BM_MatrixInverse(benchmark::State& state) {
+    const Eigen::Index n = state.range(0);
+    Eigen::MatrixXd data = Eigen::MatrixXd::Random(n, n) + n * Eigen::MatrixXd::Identity(n, n);
+    for (auto _ : state) {
+        Matrix a(data);
+        benchmark::DoNotOptimize(a.inverse());
+    }
+}
+BENCHMARK(BM_MatrixInverse)->Apply(matrixSizes);
+
+void BM_ScalarToString(benchmark::State& state) {
+    Scalar s(3.14159265358979);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(s.toString());
+    }
+}
+BENCHMARK(BM_ScalarToString);
+
+void BM_VectorToString(benchmark::State& state) {
+    const Eigen::Index n = state.range(0);
+    Vector v(Eigen::VectorXd::Random(n));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(v.toString());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_VectorToString)->Arg(16)->Arg(1024);
+
+void BM_MatrixToString(benchmark::State& state) {
+    const Eigen::Index n = state.range(0);
+    Matrix a = randomMatrix(n);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a.toString());
+    }
+    state.SetItemsProcessed(state.iterations() * n * n);
+}
+BENCHMARK(BM_MatrixToString)->Apply(matrixSizes);
+
+// Affichage complet écrit dans un flux sans destination
+void BM_MatrixWriteFull(benchmark::State& state) {
+    const Eigen::Index n = state.range(0);
+    const Value a = randomMatrix(n);
+    ValueFormatter& formatter = ValueFormatter::getInstance();
+    const FormatOptions saved = formatter.getOptions();
+    FormatOptions options = saved;
+    options.full = true;
+    options.format = state.range(1) ? NumberFormat::Shortest : NumberFormat::Fixed;
+    formatter.setOptions(options);
+    std::ostream discard(nullptr);
+    for (auto _ : state) {
+        formatter.write(discard, a);
+    }
+    formatter.setOptions(saved);
+    state.SetItemsProcessed(state.iterations() * n * n);
+}
+BENCHMARK(BM_MatrixWriteFull)->ArgsProduct({{64, 256}, {0, 1}});
+
+// Laplacien 1D (tridiagonal, symétrique défini positif) de dimension n
+SparseMatrix laplacian(Eigen::Index n) {
+    std::vector<SparseMatrix::Triplet> triplets;
+    triplets.reserve(static_cast<size_t>(3 * n));
+    for (Eigen::Index i = 0; i < n; ++i) {
+        triplets.emplace_back(i, i, 2.0);
+        if (i > 0) {
+            triplets.emplace_back(i, i - 1, -1.0);
+            triplets.emplace_back(i - 1, i, -1.0);
+        }
+    }
+    return SparseMatrix(n, n, triplets);
+}
+
+void BM_SparseMatrixVector(benchmark::State& state) {
+    const Eigen::Index n = state.range(0);
+    SparseMatrix a = laplacian(n);
+    Vector x(Eigen::VectorXd::Random(n));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a * x);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(a.nonZeros()));
+}
+BENCHMARK(BM_SparseMatrixVector)->Arg(1 << 10)->Arg(1 << 20);
+
+// Résolution directe : la décomposition est conservée entre les itérations
+void BM_SparseSolve(benchmark::State& state) {
+    const Eigen::Index n = state.range(0);
+    SparseMatrix a = laplacian(n);
+    Eigen::MatrixXd b = Eigen::MatrixXd::Random(n, 1);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a.solve(b));
+    }
+}
+BENCHMARK(BM_SparseSolve)->Arg(1 << 10)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+
+void BM_SparseConjugateGradient(benchmark::State& state) {
+    const Eigen::Index n = state.range(0);
+    SparseMatrix a = laplacian(n);
+    Eigen::VectorXd b = Eigen::VectorXd::Random(n);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a.solveIterative(IterativeMethod::ConjugateGradient, b, 1e-8, 0));
+    }
+}
+BENCHMARK(BM_SparseConjugateGradient)->Arg(1 << 8)->Arg(1 << 12)->Unit(benchmark::kMillisecond);
+
+// Scalaires stockés dans la valeur : opérateurs répartis par std::visit, sans allocation
+void BM_ValueScalarArithmetic(benchmark::State& state) {
+    const Value x = 0.75;
+    const Value y = -1.25;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(x * y + x - y / x);
+    }
+}
+BENCHMARK(BM_ValueScalarArithmetic);
+
+// Opérateurs de Value sur des matrices : même répartition, éléments calculés par Matrix
+void BM_ValueMatrixAdd(benchmark::State& state) {
+    const Eigen::Index n = state.range(0);
+    const Value a = randomMatrix(n);
+    const Value b = randomMatrix(n);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a + b);
+    }
+    state.SetItemsProcessed(state.iterations() * n * n);
+}
+BENCHMARK(BM_ValueMatrixAdd)->Apply(matrixSizes);
+
+} // namespace
@@ -0,0 +1,146 @@
+#include "Math/VectorMath.hpp"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace FusioCore;
+
+namespace {
+
+// Fonction testée, avec sa référence en long double et sa borne documentée
+struct MathFunction {
+    const char* name;
+    VectorMath::Kernel kernel;
+    long double (*reference)(long double);
+    double maxUlp;
+    double low;
+    double high;
+    bool trigonometric;
+};
+
+// Domaines et bornes du contrat de précision de VectorMath
+const MathFunction FUNCTIONS[] = {
+    {"sin", VectorMath::sin, sinl, 1.0, -8e5, 8e5, true},
+    {"cos", VectorMath::cos, cosl, 1.0, -8e5, 8e5, true},
+    {"tan", VectorMath::tan, tanl, 1.0, -8e5, 8e5, true},
+    {"exp", VectorMath::exp, expl, 1.0, -708.0, 708.0, false},
+    {"log", VectorMath::log, logl, 1.0, 0.0, 0.0, false},
+    {"log10", VectorMath::log10, log10l, 2.0, 0.0, 0.0, false},
+    {"sqrt", VectorMath::sqrt, sqrtl, 0.5, 0.0, 0.0, false},
+};
+
+constexpr long FUNCTION_COUNT = sizeof(FUNCTIONS) / sizeof(FUNCTIONS[0]);
+
+// Arguments : (fonction, jeu d'instructions), pour les niveaux supportés par la machine
+void functionsAndLevels(benchmark::internal::Benchmark* benchmark) {
+    const long widest = static_cast<long>(VectorMath::detectLevel());
+    for (long function = 0; function < FUNCTION_COUNT; ++function) {
+        for (long level = 0; level <= widest; ++level) {
+            benchmark->Args({function, level});
+        }
+    }
+}
+
+/**
+ * Arguments du domaine de la fonction : tirages uniformes, plus les doubles
+ * voisins des multiples de pi/2 pour les fonctions trigonométriques (pire
+ * cas de la réduction d'argument). Les logarithmes et sqrt parcourent tous
+ * les exposants, sous-normaux compris.
+ */
+std::vector<double> sampleArguments(const MathFunction& function, size_t count) {
+    std::mt19937_64 generator(42);
+    std::vector<double> x;
+    x.reserve(count);
+    if (function.high > function.low) {
+        std::uniform_real_distribution<double> uniform(function.low, function.high);
+        for (size_t i = 0; i < count; ++i) {
+            x.push_back(uniform(generator));
+        }
+    } else {
+        std::uniform_real_distribution<double> mantissa(1.0, 2.0);
+        std::uniform_int_distribution<int> exponent(-1074, 1023);
+        for (size_t i = 0; i < count; ++i) {
+            x.push_back(std::ldexp(mantissa(generator), exponent(generator)));
+        }
+    }
+
+    if (function.trigonometric) {
+        const long double halfPi = 1.5707963267948966192313216916397514L;
+        for (long k = -509295; k <= 509295; k += 7) {
+            double nearest = static_cast<double>(k * halfPi);
+            x.push_back(std::nextafter(nearest, -INFINITY));
+            x.push_back(nearest);
+            x.push_back(std::nextafter(nearest, INFINITY));
+        }
+    }
+    return x;
+}
+
+// Écart en ULP du résultat par rapport à la référence en long double
+double ulpError(double result, long double reference) {
+    int exponent;
+    std::frexp(static_cast<double>(reference), &exponent);
+    const long double ulp = std::ldexp(1.0L, std::max(exponent - 53, -1074));
+    return static_cast<double>(std::fabs(static_cast<long double>(result) - reference) / ulp);
+}
+
+void BM_VectorMath(benchmark::State& state) {
+    const MathFunction& function = FUNCTIONS[state.range(0)];
+    VectorMath::setLevel(static_cast<SimdLevel>(state.range(1)));
+    std::vector<double> x = sampleArguments(function, 1 << 14);
+    x.resize(1 << 14);
+    std::vector<double> out(x.size());
+    for (auto _ : state) {
+        function.kernel(x.data(), out.data(), x.size());
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<long>(x.size()));
+    state.SetLabel(std::string(function.name) + "/" + VectorMath::levelName(VectorMath::level()));
+    VectorMath::setLevel(VectorMath::detectLevel());
+}
+BENCHMARK(BM_VectorMath)->Apply(functionsAndLevels);
+
+/**
+ * Vérifie le contrat de précision de VectorMath : le benchmark échoue si
+ * l'erreur maximale dépasse la borne documentée (compteur max_ulp).
+ */
+void BM_VectorMathAccuracy(benchmark::State& state) {
+    const MathFunction& function = FUNCTIONS[state.range(0)];
+    if (sizeof(long double) <= sizeof(double)) {
+        state.SkipWithError("référence en long double non disponible");
+        return;
+    }
+    VectorMath::setLevel(static_cast<SimdLevel>(state.range(1)));
+    std::vector<double> x = sampleArguments(function, 1 << 20);
+    std::vector<double> out(x.size());
+    double maxError = 0.0;
+    double worst = 0.0;
+    for (auto _ : state) {
+        function.kernel(x.data(), out.data(), x.size());
+        for (size_t i = 0; i < x.size(); ++i) {
+            double error = ulpError(out[i], function.reference(x[i]));
+            if (error > maxError) {
+                maxError = error;
+                worst = x[i];
+            }
+        }
+    }
+    state.counters["max_ulp"] = maxError;
+    state.SetLabel(std::string(function.name) + "/" + VectorMath::levelName(VectorMath::level()));
+    VectorMath::setLevel(VectorMath::detectLevel());
+
+    if (maxError > function.maxUlp) {
+        char message[128];
+        std::snprintf(message, sizeof(message), "%s : %.3f ULP en x = %.17g (contrat : %g ULP)", function.name,
+                      maxError, worst, function.maxUlp);
+        state.SkipWithError(message);
+    }
+}
+BENCHMARK(BM_VectorMathAccuracy)->Apply(functionsAndLevels)->Iterations(1)->Unit(benchmark::kMillisecond);
+
+} // namespace
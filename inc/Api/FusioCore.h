@@ -0,0 +1,135 @@
+#ifndef FUSIOCORE_H
+#define FUSIOCORE_H
+
+/*
+ * Interface C de la bibliothèque fusiocore
+ *
+ * Une session (fusio_session) correspond à un FusioInterpreter : ses
+ * variables lui sont propres et elle n'est utilisée que par un thread à la
+ * fois. Les sessions créées avec fusio_session_create_shared partagent leurs
+ * programmes compilés et peuvent être utilisées en parallèle, une par thread.
+ *
+ * Les matrices sont échangées sans copie sous la forme pointeur, dimensions
+ * et pas (fusio_array) :
+ *   - en entrée, fusio_set_matrix référence les éléments de l'appelant
+ *     jusqu'à l'appel de la fonction release fournie ;
+ *   - en sortie, fusio_value_array décrit les éléments d'un résultat, valides
+ *     jusqu'à fusio_value_destroy.
+ *
+ * Aucune exception ne traverse l'interface : une fonction qui échoue retourne
+ * FUSIO_ERROR et le message est disponible par fusio_session_error.
+ */
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct fusio_session fusio_session;
+typedef struct fusio_value fusio_value;
+
+typedef enum fusio_status {
+    FUSIO_OK = 0,
+    FUSIO_ERROR = 1
+} fusio_status;
+
+/* Nature d'une valeur */
+typedef enum fusio_kind {
+    FUSIO_SCALAR = 0,
+    FUSIO_VECTOR = 1,
+    FUSIO_MATRIX = 2,
+    FUSIO_SPARSE = 3
+} fusio_kind;
+
+/* Type des éléments */
+typedef enum fusio_dtype {
+    FUSIO_F32 = 0,
+    FUSIO_F64 = 1,
+    FUSIO_I32 = 2,
+    FUSIO_I64 = 3
+} fusio_dtype;
+
+/*
+ * Tableau dense : l'élément (i, j) est à l'adresse
+ * data + (i * row_stride + j * col_stride) * taille d'un élément.
+ * Ordre colonne : row_stride = 1, col_stride = rows ;
+ * ordre ligne (NumPy par défaut) : row_stride = cols, col_stride = 1.
+ * Un vecteur a cols = 1.
+ */
+typedef struct fusio_array {
+    const void* data;
+    fusio_dtype dtype;
+    int64_t rows;
+    int64_t cols;
+    int64_t row_stride;  /* En éléments */
+    int64_t col_stride;  /* En éléments */
+} fusio_array;
+
+/* Matrice creuse au format CSC (colonnes compressées, indices à partir de 0) */
+typedef struct fusio_sparse {
+    int64_t rows;
+    int64_t cols;
+    int64_t nonzeros;
+    const int32_t* col_offsets;  /* cols + 1 positions dans row_indices et values */
+    const int32_t* row_indices;
+    const double* values;
+} fusio_sparse;
+
+/* Libère des éléments prêtés à la bibliothèque (context est celui passé avec eux) */
+typedef void (*fusio_release)(void* context);
+
+/* Sessions ; NULL si l'allocation échoue */
+fusio_session* fusio_session_create(void);
+fusio_session* fusio_session_create_shared(const fusio_session* peer);
+void fusio_session_destroy(fusio_session* session);
+
+/* Message de la dernière erreur de la session, "" s'il n'y en a pas */
+const char* fusio_session_error(const fusio_session* session);
+
+/*
+ * Évalue une instruction (expression, assignation, save/load/readcsv)
+ * result reçoit une nouvelle valeur à détruire par fusio_value_destroy, ou
+ * NULL si l'instruction ne produit pas de valeur ; result peut être NULL si
+ * le résultat n'est pas utilisé.
+ */
+fusio_status fusio_evaluate(fusio_session* session, const char* statement, fusio_value** result);
+
+/* Copie d'une variable (les éléments sont partagés, sans copie) */
+fusio_status fusio_get_variable(fusio_session* session, const char* name, fusio_value** result);
+fusio_status fusio_remove_variable(fusio_session* session, const char* name);
+
+fusio_status fusio_set_scalar(fusio_session* session, const char* name, double value);
+
+/*
+ * Affecte une matrice référençant les éléments de l'appelant, sans copie
+ * (éléments float64 à pas quelconques, ou autres types en ordre colonne ;
+ * les autres dispositions sont copiées). Les expressions lisent des éléments
+ * consécutifs en ordre colonne : une matrice float64 d'une autre disposition
+ * est copiée une fois, à sa première lecture. release(context) est appelée quand
+ * la bibliothèque n'utilise plus les éléments, y compris en cas d'échec ;
+ * release peut être NULL si les éléments survivent à la session.
+ * Les pas doivent être strictement positifs.
+ */
+fusio_status fusio_set_matrix(fusio_session* session, const char* name, const fusio_array* array,
+                              fusio_release release, void* context);
+
+/* Affecte un vecteur (cols = 1), copié */
+fusio_status fusio_set_vector(fusio_session* session, const char* name, const fusio_array* array);
+
+/* Accès aux valeurs ; FUSIO_ERROR si la valeur n'est pas de la nature demandée */
+fusio_kind fusio_value_kind(const fusio_value* value);
+fusio_status fusio_value_scalar(const fusio_value* value, double* out);
+/* Vecteur ou matrice dense ; une vue non contiguë est d'abord copiée dans la valeur */
+fusio_status fusio_value_array(fusio_value* value, fusio_array* out);
+/* Matrice creuse (CSC compressé), sans copie */
+fusio_status fusio_value_sparse(const fusio_value* value, fusio_sparse* out);
+/* Représentation textuelle, valide jusqu'au prochain appel pour cette valeur */
+const char* fusio_value_string(fusio_value* value);
+void fusio_value_destroy(fusio_value* value);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FUSIOCORE_H */
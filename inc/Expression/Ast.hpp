@@ -0,0 +1,101 @@
+#ifndef AST_HPP
+#define AST_HPP
+
+#include "Value/Value.hpp"
+#include <Eigen/Dense>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace FusioCore {
+
+class Value;
+
+/**
+ * Nature d'un nœud de l'arbre syntaxique
+ */
+enum class NodeKind {
+    Number,     // Littéral numérique
+    Variable,   // Référence à une variable
+    Unary,      // Opérateur préfixe (-x, +x)
+    Binary,     // Opérateur binaire
+    Transpose,  // Opérateur postfixe '
+    Call,       // Appel de fonction f(x, ...)
+    Index,      // Indexation A(i, j) d'une variable (la variable en premier enfant)
+    Range,      // Plage first:last ou first:step:last d'une indexation (':' seul sans enfant)
+    Literal,    // Littéral [a, b; c, d] (constantes dans elements, expressions en enfants)
+    Fallback    // Expression scalaire confiée à l'évaluateur scalaire (ExprTk)
+};
+
+/**
+ * Opérateurs unaires
+ */
+enum class UnaryOp {
+    Negate,
+    Plus
+};
+
+/**
+ * Opérateurs binaires
+ */
+enum class BinaryOp {
+    Add,      // +
+    Sub,      // -
+    Mul,      // * (produit matriciel)
+    Div,      // /
+    Pow,      // ^ (puissance matricielle)
+    ElemMul,  // .*
+    ElemDiv,  // ./
+    ElemPow,  // .^
+    LeftDiv   // \ (A \ b résout A * x = b)
+};
+
+/**
+ * Fonctions reconnues par le moteur natif (résolues une fois au typage)
+ */
+enum class FunctionId {
+    Unknown,
+    // Fonctions élément par élément
+    Sin, Cos, Tan, Exp, Log, Log10, Sqrt, Abs,
+    // Fonctions matricielles
+    Det, Inv, Trace, Norm, Sum, Transpose, Solve,
+    // Matrices creuses
+    Sparse, Full, Nnz, Cg, BiCgStab,
+    // Conversions du type des éléments (élément par élément)
+    Single, Double, Int32, Int64
+};
+
+/**
+ * Nœud de l'arbre syntaxique typé
+ */
+struct AstNode {
+    NodeKind kind = NodeKind::Number;
+    
+    // Données syntaxiques
+    double number = 0.0;                          // NodeKind::Number
+    std::string name;                             // NodeKind::Variable / NodeKind::Call
+    UnaryOp unaryOp = UnaryOp::Plus;              // NodeKind::Unary
+    BinaryOp binaryOp = BinaryOp::Add;            // NodeKind::Binary
+    std::vector<std::unique_ptr<AstNode>> children;
+    std::string source;                           // Texte source d'un élément de littéral ou d'un repli
+    std::vector<double> elements;                 // NodeKind::Literal : éléments ligne par ligne (0 si calculé)
+    std::vector<size_t> positions;                // NodeKind::Literal : position de chaque enfant dans elements
+    
+    // Données de typage (renseignées par BytecodeCompiler ; forme d'un littéral fixée par le Parser)
+    ValueKind type = ValueKind::Scalar;
+    Eigen::Index rows = 1;
+    Eigen::Index cols = 1;
+    DType dtype = DType::F64;                     // Éléments d'un vecteur ou d'une matrice
+    FunctionId function = FunctionId::Unknown;    // NodeKind::Call
+    const Value* value = nullptr;                 // NodeKind::Variable liée (environnement, le temps de la compilation)
+    Matrix::Range rowRange;                       // NodeKind::Index : lignes (ou éléments d'un vecteur) sélectionnées
+    Matrix::Range colRange;                       // NodeKind::Index : colonnes sélectionnées
+    
+    bool isScalar() const { return type == ValueKind::Scalar; }
+};
+
+using AstPtr = std::unique_ptr<AstNode>;
+
+} // namespace FusioCore
+
+#endif // AST_HPP
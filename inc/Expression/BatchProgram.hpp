@@ -0,0 +1,79 @@
+#ifndef BATCH_PROGRAM_HPP
+#define BATCH_PROGRAM_HPP
+
+#include "Expression/Ast.hpp"
+#include "Expression/ElementwiseProgram.hpp"
+#include "Expression/IExpressionEvaluator.hpp"
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace FusioCore {
+
+/**
+ * Formule scalaire compilée pour l'évaluation par lots (evaluateBatch)
+ *
+ * La formule est analysée par le Parser puis compilée une fois en
+ * ElementwiseProgram dont les entrées sont les colonnes : l'exécution
+ * parcourt les lignes par tuiles avec les noyaux vectorisés, réparties sur
+ * le pool de threads au-delà de ThreadPool::PARALLEL_THRESHOLD lignes. Les
+ * opérateurs gardent leur sens scalaire, ligne par ligne (* / ^ sont
+ * appliqués élément par élément). Les sous-expressions qui ne lisent aucune
+ * colonne (nombres, variables scalaires de l'environnement) sont calculées
+ * à la compilation.
+ */
+class BatchProgram {
+public:
+    /**
+     * Compile une formule
+     * @param expression La formule
+     * @param columns Les noms des colonnes, dans l'ordre où elles seront liées
+     * @param variables L'environnement, pour les autres variables (lues à la compilation)
+     * @return Le programme, ou nullptr si la formule sort de la grammaire native
+     *         (comparaisons, fonctions ExprTk), lit une variable inconnue ou non scalaire
+     */
+    static std::unique_ptr<BatchProgram> compile(const std::string& expression,
+                                                 const std::vector<std::string>& columns,
+                                                 IExpressionEvaluator& variables);
+    
+    /**
+     * Nombre de lignes d'un ensemble de colonnes
+     * @throw std::runtime_error s'il n'y a aucune colonne ou si leurs tailles diffèrent
+     */
+    static Eigen::Index rowCount(const std::vector<BatchColumn>& columns);
+    
+    /**
+     * Exécute la formule sur toutes les lignes
+     * @param columns Les colonnes, dans l'ordre des noms passés à compile
+     */
+    Eigen::VectorXd run(const std::vector<BatchColumn>& columns) const;
+
+private:
+    // Résultat de la compilation d'un nœud : registre du programme, ou constante si reg < 0
+    struct Operand {
+        int reg = -1;
+        double constant = 0.0;
+    };
+    
+    BatchProgram() = default;
+    
+    // Compile un nœud ; false si le nœud sort de la grammaire de l'évaluation par lots
+    bool compileNode(const AstNode& node, const std::vector<std::string>& columns,
+                     IExpressionEvaluator& variables, Operand& result);
+    
+    // Entrée du programme associée à une colonne (une seule par colonne)
+    int bindColumn(size_t column);
+    
+    // Scalaire diffusé de valeur constante
+    int bindScalar(double value);
+    
+    ElementwiseProgram program_;
+    std::vector<size_t> inputs_;            // Colonne de chaque entrée, dans l'ordre de addInput
+    std::vector<int> columnRegisters_;      // Registre de chaque colonne, -1 si elle n'est pas lue
+    std::vector<double> scalars_;           // Valeurs des scalaires, dans l'ordre de addScalar
+    Operand result_;
+};
+
+} // namespace FusioCore
+
+#endif // BATCH_PROGRAM_HPP
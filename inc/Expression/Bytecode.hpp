@@ -0,0 +1,170 @@
+#ifndef BYTECODE_HPP
+#define BYTECODE_HPP
+
+#include "Expression/Ast.hpp"
+#include "Expression/ElementwiseProgram.hpp"
+#include "Value/SparseMatrix.hpp"
+#include <Eigen/Dense>
+#include <string>
+#include <vector>
+
+namespace FusioCore {
+
+/**
+ * Opérations de la machine virtuelle
+ *
+ * Chaque opération lit ses opérandes dans des registres typés (scalaire,
+ * vecteur ou matrice, dimensions fixées à la compilation) et écrit dans le
+ * registre dst. Le coefficient d'une opération vaut
+ * constant * scale, où scale est un registre scalaire facultatif.
+ */
+enum class OpCode {
+    // Scalaires
+    LoadConstant,    // dst = constant
+    ScalarNegate,    // dst = -a
+    ScalarBinary,    // dst = a op b (aux : BinaryOp)
+    ScalarFunction,  // dst = f(a) (aux : FunctionId)
+    ScalarFallback,  // dst = évaluation scalaire de sources[aux] (ExprTk)
+    Dot,             // dst = a · b
+    Reduce,          // dst = det/trace/norm/sum(a) (aux : FunctionId)
+    LoadElement,     // dst = a[offsets[aux]] (indice en ordre colonne)
+    
+    // Vecteurs et matrices
+    Fill,            // dst = coefficient partout
+    AddConstant,     // dst += coefficient
+    Scale,           // dst = coefficient * op(a) (aux : TRANSPOSE_LHS)
+    AddScaled,       // dst += coefficient * op(a) (aux : TRANSPOSE_LHS)
+    ScaleInPlace,    // dst *= coefficient
+    Transpose,       // dst = a'
+    Slice,           // dst = slices[aux] appliqué à a
+    Gemm,            // dst (=, +=) coefficient * op(a) * op(b) (aux : drapeaux)
+    Solve,           // dst = a \ b
+    Inverse,         // dst = inv(a)
+    MatrixPower,     // dst = a ^ b (b scalaire entier)
+    Fused,           // dst = kernels[aux] appliqué aux registres liés
+    LoadLiteral,     // dst = literals[aux]
+    SetElement,      // dst[offsets[aux]] = a (indice en ordre colonne)
+    
+    // Matrices creuses (registres ValueKind::Sparse, valeurs conservées dans le Frame)
+    SparseFromDense,     // dst = sparse(a)
+    SparseFromTriplets,  // dst = sparse(a, b, registre aux) : lignes, colonnes (à partir de 1) et valeurs ; vide si a < 0
+    SparseToDense,       // dst = full(a)
+    SparseScale,         // dst = coefficient * op(a) (aux : TRANSPOSE_LHS)
+    SparseBinary,        // dst = a op b, a et b creuses (aux : BinaryOp +, - ou *)
+    SparseAddTo,         // dst += coefficient * a, dst dense
+    SparseProduct,       // dst (=, +=) coefficient * op(a) * op(b), a ou b creuse, dst dense (aux : drapeaux)
+    SparseSolve          // dst = a \ b, a creuse (aux : indice dans solvers)
+};
+
+/**
+ * Instruction de la machine virtuelle
+ */
+struct Instruction {
+    // Drapeaux de aux pour Scale, AddScaled et Gemm
+    static constexpr int TRANSPOSE_LHS = 1;
+    static constexpr int TRANSPOSE_RHS = 2;
+    static constexpr int ACCUMULATE = 4;
+    
+    OpCode op = OpCode::LoadConstant;
+    int dst = -1;
+    int a = -1;
+    int b = -1;
+    int scale = -1;          // Registre scalaire multipliant constant, -1 si aucun
+    double constant = 1.0;
+    int aux = 0;
+};
+
+/**
+ * Provenance du stockage d'un registre
+ */
+enum class RegisterStorage {
+    Temporary,  // Stockage propre au Frame, réutilisé d'une exécution à l'autre
+    Variable,   // Données d'une variable, liées à chaque exécution
+    Result      // Stockage de la valeur retournée, alloué à chaque exécution
+};
+
+/**
+ * Registre typé
+ */
+struct RegisterInfo {
+    ValueKind type = ValueKind::Scalar;
+    Eigen::Index rows = 1;
+    Eigen::Index cols = 1;
+    RegisterStorage storage = RegisterStorage::Temporary;
+    int variable = -1;  // Indice dans Program::variables (RegisterStorage::Variable)
+};
+
+/**
+ * Variable lue par un programme : son type et ses dimensions à la
+ * compilation forment une garde vérifiée avant chaque exécution
+ */
+struct VariableGuard {
+    std::string name;
+    bool defined = false;
+    ValueKind type = ValueKind::Scalar;
+    Eigen::Index rows = 1;
+    Eigen::Index cols = 1;
+    DType dtype = DType::F64;
+    int reg = -1;  // Registre lié, -1 si la variable n'est que gardée
+    
+    // Scalaire dont la valeur fixe des indices : la garde porte aussi sur elle
+    bool pinned = false;
+    double value = 0.0;
+};
+
+/**
+ * Sous-matrice d'un registre (indices à partir de 0), éventuellement transposée
+ */
+struct SliceInfo {
+    Matrix::Range rows;
+    Matrix::Range cols;
+    bool transposed = false;
+};
+
+/**
+ * Résolution d'un système creux : directe (A \ b) ou itérative (cg, bicgstab)
+ */
+struct SolverInfo {
+    // Erreur relative visée par défaut des solveurs itératifs
+    static constexpr double DEFAULT_TOLERANCE = 1e-10;
+    
+    bool iterative = false;
+    IterativeMethod method = IterativeMethod::ConjugateGradient;
+    int tolerance = -1;   // Registre scalaire de l'erreur visée, -1 : DEFAULT_TOLERANCE
+    int iterations = -1;  // Registre scalaire du nombre maximal d'itérations, -1 : défaut d'Eigen
+};
+
+/**
+ * Programme élément par élément et registres liés à ses entrées
+ */
+struct FusedKernel {
+    ElementwiseProgram program;
+    std::vector<int> inputs;   // Registres vecteur/matrice, dans l'ordre de addInput
+    std::vector<int> scalars;  // Registres scalaires, dans l'ordre de addScalar
+};
+
+/**
+ * Instruction compilée : code, registres et gardes
+ *
+ * Un Program est immuable une fois compilé ; l'état d'une exécution
+ * (stockage des registres, variables liées) vit dans VirtualMachine::Frame.
+ */
+struct Program {
+    std::string target;                  // Variable assignée, vide pour une expression
+    std::vector<Instruction> code;
+    std::vector<RegisterInfo> registers;
+    std::vector<VariableGuard> variables;
+    std::vector<FusedKernel> kernels;
+    std::vector<std::string> sources;    // Expressions confiées à l'évaluateur scalaire
+    std::vector<Eigen::MatrixXd> literals;  // Constantes des littéraux, en ordre colonne
+    std::vector<SliceInfo> slices;
+    std::vector<SolverInfo> solvers;
+    std::vector<Eigen::Index> offsets;   // Indices d'éléments (LoadElement, SetElement) : au-delà de 2^31 sur 64 bits
+    int result = -1;
+    int view = -1;                       // Vue (indice dans slices) retournée sur la variable result, sans copie
+    DType dtype = DType::F64;            // Éléments d'un résultat calculé (registres en double, convertis à la fin)
+};
+
+} // namespace FusioCore
+
+#endif // BYTECODE_HPP
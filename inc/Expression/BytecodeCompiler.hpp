@@ -0,0 +1,189 @@
+#ifndef BYTECODE_COMPILER_HPP
+#define BYTECODE_COMPILER_HPP
+
+#include "Expression/Ast.hpp"
+#include "Expression/Bytecode.hpp"
+#include "Expression/IExpressionEvaluator.hpp"
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace FusioCore {
+
+/**
+ * Compilateur des instructions de l'interpréteur vers le bytecode
+ *
+ * Une instruction (`x = expr`, expression ou littéral `[a, b; c, d]`) est
+ * analysée par le Parser, typée avec les variables courantes (dimensions
+ * vérifiées avant tout calcul), puis traduite en opérations sur des
+ * registres typés. Les sommes sont aplaties en combinaisons linéaires et les
+ * produits accumulés par GEMM, de sorte que `A*B + 2*C'` ne crée aucun
+ * temporaire intermédiaire ; les chaînes élément par élément telles que
+ * `exp(sin(A))*2 + B` deviennent un ElementwiseProgram fusionné. Les
+ * expressions scalaires hors de la grammaire native (comparaisons, fonctions
+ * ExprTk) sont confiées à l'évaluateur scalaire.
+ *
+ * Le programme produit est spécialisé pour le type et les dimensions des
+ * variables lues, consignés dans ses gardes. Les indices d'une indexation
+ * `A(1:100, :)` sont fixés à la compilation : les scalaires qu'ils lisent
+ * sont gardés par valeur. Une sous-matrice ou une transposée de variable
+ * (`B = A(1:100, :)`, `B = A'`) est retournée comme une vue, sans copie.
+ *
+ * Les matrices creuses (SparseMatrix) ont leur propre type de registre : les
+ * produits, sommes et résolutions qui en lisent une sont traduits en
+ * opérations creuses (produit creux-dense, LDLᵀ/LU creuses, gradient
+ * conjugué, BiCGSTAB), le résultat restant creux tant que l'opération le permet.
+ *
+ * Le type des éléments (single, double, int32, int64) fait partie des gardes.
+ * Les registres restent en double ; le type du résultat, déduit des règles de
+ * promotion (DType), est appliqué une seule fois à la fin du programme.
+ */
+class BytecodeCompiler {
+public:
+    /**
+     * @param variables L'évaluateur qui détient l'environnement des variables
+     */
+    explicit BytecodeCompiler(IExpressionEvaluator& variables);
+    
+    /**
+     * Compile une instruction
+     * @param statement L'instruction à compiler
+     * @return Le programme spécialisé pour les variables courantes
+     * @throw std::runtime_error si l'instruction est invalide ou mal typée
+     */
+    std::shared_ptr<const Program> compile(const std::string& statement);
+    
+    /**
+     * Fonction native d'un nom (sin, det, solve, ...)
+     * @return FunctionId::Unknown si le nom n'est pas celui d'une fonction native
+     */
+    static FunctionId lookupFunction(const std::string& name);
+    
+    /**
+     * Type et dimensions d'un opérateur binaire (un vecteur est n x 1, v * w
+     * est le produit scalaire, un produit 1 x 1 est un scalaire)
+     * @param node Le nœud Binary, ses deux opérandes typés ; s \ X devient X / s
+     * @throw std::runtime_error si l'opération n'est pas définie pour ces types ou dimensions
+     */
+    static void typeBinary(AstNode& node);
+    
+    /**
+     * Découpe une assignation "nom = expression" ("x == y" est une comparaison)
+     * @param statement L'instruction
+     * @param name La variable assignée, si l'instruction est une assignation
+     * @param expression L'expression assignée, si l'instruction est une assignation
+     * @return false si l'instruction n'est pas une assignation (name et expression inchangés)
+     */
+    static bool splitAssignment(const std::string& statement, std::string& name, std::string& expression);
+
+private:
+    // Coefficient constant * scale (registre scalaire, -1 si aucun)
+    struct Coefficient {
+        Coefficient(double constantValue = 1.0, int scaleRegister = -1)
+            : constant(constantValue), scale(scaleRegister) {}
+        
+        double constant;
+        int scale;
+        
+        bool isOne() const { return constant == 1.0 && scale < 0; }
+    };
+    
+    // Terme d'une combinaison linéaire : coefficient * noeud
+    struct Term {
+        Coefficient coef;
+        const AstNode* node;
+    };
+    
+    // Statistiques d'une région élément par élément
+    struct FusionStats {
+        int nonlinearOps = 0;
+        int opaqueLeaves = 0;
+    };
+    
+    // Analyse et type une expression ; hors grammaire native, un nœud de repli
+    AstPtr prepare(const std::string& expression);
+    
+    // Lie les variables de l'arbre, enregistre leurs gardes et détecte les vecteurs/matrices ;
+    // un appel dont le nom est une variable vecteur/matrice devient une indexation
+    void resolveVariables(AstNode& node, bool& hasArray, bool inIndex = false);
+    
+    // Détermine le type et les dimensions d'un nœud (post-ordre)
+    void typeNode(AstNode& node);
+    void typeCall(AstNode& node);
+    void typeLiteral(AstNode& node);
+    void typeIndex(AstNode& node);
+    static void typeSparseBinary(AstNode& node);
+    void typeSparseCall(AstNode& node);
+    
+    // Indices sélectionnés par un argument d'indexation (plage ou indice), extent : dimension indexée
+    Matrix::Range indexRange(const AstNode& argument, Eigen::Index extent, bool& single);
+    
+    // Valeur d'une expression d'indice (nombres, scalaires gardés par valeur, end)
+    double foldIndex(const AstNode& node, Eigen::Index extent);
+    
+    // Remplace un nœud scalaire par un repli sur l'évaluateur scalaire
+    void makeFallback(AstNode& node, const std::string& source);
+    
+    // Registres
+    int addRegister(ValueKind type, Eigen::Index rows, Eigen::Index cols,
+                    RegisterStorage storage = RegisterStorage::Temporary);
+    int temporaryFor(const AstNode& node);
+    
+    // Ajoute une instruction
+    void emit(OpCode op, int dst, int a = -1, int b = -1, Coefficient coef = {}, int aux = 0);
+    
+    // Range un indice d'élément dans Program::offsets, retourne sa position (aux)
+    int addOffset(Eigen::Index offset);
+    
+    // Sous-matrice ou transposée d'une variable matrice : résultat retourné
+    // comme une vue sur ses éléments ; false si la racine n'est pas de cette forme
+    bool compileView(const AstNode& root);
+    
+    // Émet le calcul d'un nœud scalaire, retourne son registre
+    int compileScalar(const AstNode& node);
+    
+    // Émet le calcul d'un nœud vectoriel/matriciel dans le registre dst
+    void compileInto(const AstNode& node, int dst);
+    
+    // Émet le calcul d'un nœud creux, retourne son registre
+    int compileSparse(const AstNode& node);
+    
+    // Registre contenant la valeur d'un opérande (temporaire si nécessaire)
+    int operand(const AstNode& node);
+    
+    // Coefficient multiplié (ou divisé) par un nœud scalaire
+    Coefficient multiply(Coefficient coef, const AstNode& factor);
+    Coefficient divide(Coefficient coef, const AstNode& divisor);
+    
+    // Aplatit une somme en combinaison linéaire de termes
+    void collectTerms(const AstNode& node, Coefficient coef, std::vector<Term>& terms);
+    
+    // Écrit (assign) ou accumule un terme dans dst
+    void accumulateTerm(const Term& term, int dst, bool assign);
+    
+    // Produit matriciel coef * lhs * rhs, transposées comprises, sans temporaire
+    void accumulateProduct(const AstNode& lhs, const AstNode& rhs, Coefficient coef, int dst, bool assign);
+    
+    // Indique si un nœud peut appartenir à un programme élément par élément
+    bool isFusible(const AstNode& node) const;
+    
+    // Compte les opérations non linéaires et les feuilles à matérialiser d'une région fusionnable
+    void analyzeFusion(const AstNode& node, FusionStats& stats) const;
+    
+    // Indique si le sous-arbre doit être évalué par un programme fusionné
+    bool shouldFuse(const AstNode& node) const;
+    
+    // Compile une région fusionnable, retourne le registre de son résultat
+    int compileFused(const AstNode& node, FusedKernel& kernel);
+    
+    IExpressionEvaluator& variables_;
+    
+    // Programme en cours de compilation
+    std::shared_ptr<Program> program_;
+    std::map<std::string, int> guards_;  // Nom -> indice dans program_->variables
+};
+
+} // namespace FusioCore
+
+#endif // BYTECODE_COMPILER_HPP
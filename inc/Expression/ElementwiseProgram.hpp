@@ -0,0 +1,116 @@
+#ifndef ELEMENTWISE_PROGRAM_HPP
+#define ELEMENTWISE_PROGRAM_HPP
+
+#include "Expression/Ast.hpp"
+#include <Eigen/Dense>
+#include <vector>
+
+namespace FusioCore {
+
+/**
+ * Programme élément par élément fusionné
+ *
+ * Un sous-arbre d'opérations élément par élément (fonctions, + - .* ./ .^,
+ * diffusion de scalaires) est compilé en une suite d'instructions dont les
+ * noyaux sont résolus une fois pour toutes. L'exécution parcourt la mémoire
+ * en une seule passe, par tuiles qui tiennent dans le cache L1 : chaque
+ * entrée est lue une fois, le résultat écrit une fois, et les intermédiaires
+ * ne dépassent jamais la taille d'une tuile. Au-delà de
+ * ThreadPool::PARALLEL_THRESHOLD éléments, des blocs de tuiles sont répartis
+ * sur le pool de threads ; chaque élément est calculé indépendamment, le
+ * résultat ne dépend donc pas du nombre de threads. Les entrées et les
+ * scalaires ne sont liés qu'à l'exécution : un programme compilé une fois est
+ * réexécuté tel quel sur de nouvelles valeurs.
+ */
+class ElementwiseProgram {
+public:
+    // Noyaux : f(x), f(x, y), f(x, s) où s est un scalaire diffusé
+    using UnaryKernel = void (*)(const double* x, double* out, Eigen::Index n);
+    using BinaryKernel = void (*)(const double* x, const double* y, double* out, Eigen::Index n);
+    using ScalarKernel = void (*)(const double* x, double s, double* out, Eigen::Index n);
+    
+    // Nombre d'éléments traités par tuile
+    static constexpr Eigen::Index TILE_SIZE = 1024;
+    
+    // Nombre d'éléments confiés à un thread à la fois
+    static constexpr Eigen::Index PARALLEL_GRAIN = 16 * TILE_SIZE;
+    
+    /**
+     * Déclare une entrée contiguë (même nombre d'éléments que le résultat)
+     * @return Le registre associé ; l'entrée est liée à l'exécution, dans l'ordre des déclarations
+     */
+    int addInput();
+    
+    /**
+     * Déclare un scalaire diffusé, lié à l'exécution dans l'ordre des déclarations
+     * @return L'indice du scalaire
+     */
+    int addScalar();
+    
+    /**
+     * Ajoute out = f(x)
+     * @return Le registre résultat
+     */
+    int emitUnary(FunctionId function, int x);
+    
+    /**
+     * Ajoute out = x op y pour deux registres
+     * @return Le registre résultat
+     */
+    int emitBinary(BinaryOp op, int x, int y);
+    
+    /**
+     * Ajoute out = x op s (ou s op x si scalarOnLeft)
+     * @param scalar L'indice du scalaire retourné par addScalar
+     * @return Le registre résultat
+     */
+    int emitScalar(BinaryOp op, int x, int scalar, bool scalarOnLeft);
+    
+    /**
+     * Indique si une fonction dispose d'un noyau élément par élément
+     */
+    static bool supports(FunctionId function);
+    
+    /**
+     * Exécute le programme : le dernier registre est écrit dans out
+     * @param inputs Les entrées, dans l'ordre des appels à addInput
+     * @param scalars Les scalaires, dans l'ordre des appels à addScalar
+     * @param out Destination contiguë de n éléments
+     * @param n Nombre d'éléments
+     */
+    void run(const double* const* inputs, const double* scalars, double* out, Eigen::Index n) const;
+    
+private:
+    struct Register {
+        int input = -1;  // Indice de l'entrée en mémoire, -1 pour un temporaire
+        int slot = -1;   // Tampon de tuile d'un temporaire
+    };
+    
+    struct Instruction {
+        UnaryKernel unary = nullptr;
+        BinaryKernel binary = nullptr;
+        ScalarKernel scalar = nullptr;
+        int x = -1;
+        int y = -1;
+        int scalarIndex = -1;
+        int out = -1;
+    };
+    
+    // Exécute le programme sur les éléments [begin, end)
+    void runRange(const double* const* inputs, const double* scalars, double* out,
+                  Eigen::Index begin, Eigen::Index end) const;
+    
+    // Alloue le registre résultat en recyclant les tampons des opérandes consommés
+    int allocateTemporary(int x, int y);
+    
+    std::vector<Register> registers_;
+    std::vector<Instruction> instructions_;
+    std::vector<int> freeSlots_;
+    int slotCount_ = 0;
+    int inputCount_ = 0;
+    int scalarCount_ = 0;
+};
+
+} // namespace FusioCore
+
+#endif // ELEMENTWISE_PROGRAM_HPP
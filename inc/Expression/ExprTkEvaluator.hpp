@@ -2,9 +2,13 @@
 #define EXPRTK_EVALUATOR_HPP
 
 #include "Expression/IExpressionEvaluator.hpp"
+#include <list>
 #include <map>
 #include <string>
+#include <string_view>
 #include <memory>
+#include <unordered_map>
+#include <unordered_set>
 #include <exprtk.hpp>
 
 namespace FusioCore {
@@ -14,38 +18,101 @@ namespace FusioCore {
  */
 class ExprTkEvaluator : public IExpressionEvaluator {
 public:
-    ExprTkEvaluator();
+    // Capacité par défaut du cache d'expressions compilées
+    static constexpr size_t DEFAULT_CACHE_CAPACITY = 256;
+    
+    // Lignes d'un bloc de l'évaluation par lots hors grammaire native (une compilation ExprTk par bloc)
+    static constexpr Eigen::Index BATCH_BLOCK = 1 << 14;
+
+    /**
+     * Statistiques du cache d'expressions compilées
+     */
+    struct CacheStats {
+        size_t hits = 0;      // Évaluations servies par le cache
+        size_t misses = 0;    // Évaluations ayant nécessité une compilation
+        size_t size = 0;      // Nombre d'expressions actuellement en cache
+        size_t capacity = 0;  // Nombre maximal d'expressions conservées
+    };
+
+    explicit ExprTkEvaluator(size_t cacheCapacity = DEFAULT_CACHE_CAPACITY);
     ~ExprTkEvaluator() override;
     
-    std::shared_ptr<IValue> evaluate(const std::string& expression) override;
+    Value evaluate(const std::string& expression) override;
     bool isValid(const std::string& expression) override;
-    void setVariable(const std::string& name, const std::shared_ptr<IValue>& value) override;
-    std::shared_ptr<IValue> getVariable(const std::string& name) override;
+    
+    /**
+     * Les formules de la grammaire native sont exécutées par un BatchProgram
+     * (noyaux vectorisés) ; les autres (comparaisons, fonctions ExprTk) sont
+     * compilées par ExprTk une fois par bloc de BATCH_BLOCK lignes, les blocs
+     * étant répartis sur le pool de threads.
+     */
+    Vector evaluateBatch(const std::string& expression, const std::vector<BatchColumn>& columns) override;
+    void setVariable(const std::string& name, Value value) override;
+    Value* getVariable(const std::string& name) override;
     void removeVariable(const std::string& name) override;
     void clearVariables() override;
+
+    /**
+     * Retourne les statistiques du cache d'expressions compilées
+     * @return Les compteurs de succès/échecs, la taille et la capacité du cache
+     */
+    CacheStats getCacheStats() const;
+
+    /**
+     * Modifie la capacité du cache (les entrées les moins récentes sont évincées)
+     * @param capacity Le nombre maximal d'expressions conservées (0 désactive le cache)
+     */
+    void setCacheCapacity(size_t capacity);
+
+    /**
+     * Vide le cache d'expressions compilées et remet ses compteurs à zéro
+     */
+    void clearCache();
     
 private:
-    // Convertit un IValue en double pour ExprTk
-    double valueToDouble(const std::shared_ptr<IValue>& value) const;
+    // Entrée du cache : texte source et expression compilée associée
+    using CacheEntry = std::pair<std::string, exprtk::expression<double>>;
+
+    // Convertit une valeur en double pour ExprTk (norme d'un vecteur ou d'une matrice)
+    double valueToDouble(const Value& value) const;
     
-    // Convertit un double en IValue (Scalar)
-    std::shared_ptr<IValue> doubleToValue(double value) const;
+    // Calcule la valeur ExprTk des vecteurs et matrices affectés depuis la dernière évaluation
+    void updateArrayVariables();
     
-    // Mise à jour des variables dans l'environnement ExprTk
-    void updateExprTkVariables();
+    // Libère les expressions compilées (après suppression de symboles)
+    void dropCompiledExpressions();
+
+    // Retourne l'expression compilée (depuis le cache ou après compilation), nullptr si invalide
+    exprtk::expression<double>* compile(const std::string& expression);
+
+    // Évince les entrées les moins récemment utilisées au-delà de la capacité
+    void evictOverflow();
     
     // Symboles ExprTk
     exprtk::symbol_table<double> symbolTable_;
-    exprtk::expression<double> expression_;
     exprtk::parser<double> parser_;
+
+    // Cache LRU : la liste est ordonnée du plus récent au plus ancien,
+    // l'index référence les clés stockées dans les nœuds de la liste
+    std::list<CacheEntry> cacheEntries_;
+    std::unordered_map<std::string_view, std::list<CacheEntry>::iterator> cacheIndex_;
+    size_t cacheCapacity_;
+    exprtk::expression<double> uncachedExpression_;  // Utilisée lorsque le cache est désactivé
+    size_t cacheHits_ = 0;
+    size_t cacheMisses_ = 0;
     
-    // Variables stockées
-    std::map<std::string, std::shared_ptr<IValue>> variables_;
+    // Variables stockées (les nœuds de std::map ne sont jamais déplacés :
+    // getVariable retourne un pointeur stable)
+    std::map<std::string, Value> variables_;
     
-    // Variables ExprTk
+    // Emplacements des variables ExprTk : les nœuds de std::map ne sont jamais
+    // déplacés, ExprTk s'y lie par référence une seule fois à la création
     std::map<std::string, double> exprTkVariables_;
+    
+    // Vecteurs et matrices dont l'emplacement ExprTk n'est pas encore à jour
+    std::unordered_set<std::string> staleVariables_;
 };
 
 } // namespace FusioCore 
 
-#endif // EXPRTK_EVALUATOR_HPP
\ No newline at end of file
+#endif // EXPRTK_EVALUATOR_HPP
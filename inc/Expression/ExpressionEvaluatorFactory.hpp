@@ -12,7 +12,7 @@ namespace FusioCore {
  */
 enum class EvaluatorType {
     EXPRTK,  // Utilise la bibliothèque ExprTk
-    // Autres types d'évaluateurs peuvent être ajoutés ici
+    NATIVE   // NativeEvaluator : grammaire du Parser, constantes repliées, sous-expressions communes partagées
 };
 
 /**
@@ -34,6 +34,23 @@ public:
      * @throw std::runtime_error si le nom est inconnu
      */
     static std::shared_ptr<IExpressionEvaluator> createEvaluator(const std::string& name);
+    
+    /**
+     * Type d'évaluateur désigné par un nom ("exprtk", "native")
+     * @throw std::runtime_error si le nom est inconnu
+     */
+    static EvaluatorType typeFromName(const std::string& name);
+    static const char* typeName(EvaluatorType type);
+    
+    /**
+     * Type d'évaluateur des nouvelles sessions (FusioInterpreter)
+     *
+     * Lu dans la variable d'environnement FUSIO_EVALUATOR ("exprtk" par
+     * défaut) et modifiable à l'exécution, pour comparer les moteurs sans
+     * recompiler. Les sessions existantes gardent leur évaluateur.
+     */
+    static EvaluatorType getDefaultType();
+    static void setDefaultType(EvaluatorType type);
 };
 
 } // namespace FusioCore 
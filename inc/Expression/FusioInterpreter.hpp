@@ -2,27 +2,77 @@
 #define FUSIO_INTERPRETER_HPP
 
 #include "Expression/IExpressionEvaluator.hpp"
-#include "Expression/ExprTkEvaluator.hpp"
-#include <map>
+#include "Expression/BytecodeCompiler.hpp"
+#include "Expression/ExpressionEvaluatorFactory.hpp"
+#include "Expression/ProgramCache.hpp"
+#include "Expression/VirtualMachine.hpp"
+#include "IO/CsvReader.hpp"
+#include <list>
 #include <string>
+#include <string_view>
 #include <memory>
+#include <unordered_map>
 #include <vector>
-#include <regex>
 
 namespace FusioCore {
 
-
+/**
+ * Interpréteur des instructions saisies (assignations, expressions, littéraux)
+ *
+ * Chaque instruction est compilée une fois en bytecode puis conservée dans un
+ * cache indexé par son texte : une instruction réexécutée (boucle, script)
+ * ne repasse ni par l'analyse ni par le typage. Si le type ou les dimensions
+ * d'une variable lue changent, le programme est recompilé.
+ *
+ * Les instructions save et load (fichiers .fmat) et readcsv sont traitées à
+ * part : la grammaire des expressions ne connaît pas les chaînes de caractères.
+ *
+ * Les variables et les expressions hors du bytecode sont confiées à un
+ * évaluateur créé par ExpressionEvaluatorFactory (ExprTk par défaut, ou
+ * NativeEvaluator). Avec EvaluatorType::NATIVE, une instruction de la
+ * grammaire de NativeEvaluator (expression ou assignation) lui est confiée
+ * entière, avec son repliement des constantes et ses sous-expressions
+ * communes ; seules les autres (indexations A(i, j), vues) passent par le
+ * bytecode. Les deux backends se comparent ainsi sur les mêmes instructions.
+ *
+ * Un interpréteur est une session : ses variables, son évaluateur et
+ * l'état d'exécution de ses programmes lui sont propres, et il n'est utilisé
+ * que par un thread à la fois. Les programmes compilés, immuables, sont
+ * partagés par les sessions construites avec le même ProgramCache : un
+ * processus évalue ainsi des requêtes indépendantes sur tous ses cœurs, une
+ * session par thread, sans recompiler une instruction déjà vue par une autre.
+ * Un programme qui confie des expressions à l'évaluateur n'est partagé
+ * qu'entre sessions du même type d'évaluateur (voir ProgramCache).
+ */
 class FusioInterpreter {
 public:
+    // Nombre maximal d'instructions compilées conservées
+    static constexpr size_t STATEMENT_CACHE_CAPACITY = 256;
+    
+    // Session isolée, avec son propre cache de programmes et l'évaluateur par défaut
     FusioInterpreter();
+    
+    /**
+     * Session partageant ses programmes compilés avec d'autres sessions
+     * @param programs Le cache partagé (accès concurrents autorisés)
+     * @param type L'évaluateur de la session (ExpressionEvaluatorFactory::getDefaultType par défaut)
+     */
+    explicit FusioInterpreter(std::shared_ptr<ProgramCache> programs,
+                              EvaluatorType type = ExpressionEvaluatorFactory::getDefaultType());
+    
     ~FusioInterpreter();
     
+    // Type de l'évaluateur de la session
+    EvaluatorType getEvaluatorType() const;
+    
     /**
      * Évalue une expression ou une commande
+     * Les avertissements de l'évaluation (voir Warnings) sont disponibles
+     * ensuite par Warnings::take(), jusqu'à l'évaluation suivante.
      * @param input L'entrée utilisateur à évaluer
      * @return Le résultat de l'évaluation
      */
-    std::shared_ptr<IValue> evaluate(const std::string& input);
+    Value evaluate(const std::string& input);
     
     /**
      * Vérifie si une expression est valide
@@ -31,19 +81,28 @@ public:
      */
     bool isValid(const std::string& input);
     
+    /**
+     * Évalue une formule scalaire sur chaque ligne d'un ensemble de colonnes
+     * (voir IExpressionEvaluator::evaluateBatch)
+     * @param expression La formule, compilée une seule fois
+     * @param columns Les colonnes, référencées sans copie ; les autres variables sont celles de la session
+     * @return Le résultat de chaque ligne
+     */
+    Vector evaluateBatch(const std::string& expression, const std::vector<BatchColumn>& columns);
+    
     /**
      * Définit une variable dans l'environnement d'évaluation
      * @param name Le nom de la variable
      * @param value La valeur de la variable
      */
-    void setVariable(const std::string& name, const std::shared_ptr<IValue>& value);
+    void setVariable(const std::string& name, Value value);
     
     /**
      * Obtient la valeur d'une variable
      * @param name Le nom de la variable
-     * @return La valeur de la variable, ou nullptr si elle n'existe pas
+     * @return La valeur de la variable, sans copie, ou nullptr si elle n'existe pas
      */
-    std::shared_ptr<IValue> getVariable(const std::string& name);
+    const Value* getVariable(const std::string& name);
     
     /**
      * Supprime une variable de l'environnement d'évaluation
@@ -60,45 +119,66 @@ public:
      * Liste toutes les variables définies dans l'environnement
      * @return Un vecteur de paires (nom, valeur) des variables
      */
-    std::vector<std::pair<std::string, std::shared_ptr<IValue>>> listVariables() const;
+    std::vector<std::pair<std::string, Value>> listVariables() const;
+    
+    /**
+     * Statistiques du dernier readcsv (dimensions, durée, débit)
+     */
+    const CsvStats& getLastImport() const;
+    
+    /**
+     * Restreint save, load et readcsv aux fichiers d'un répertoire (session
+     * exposée à des clients, par exemple celles du serveur)
+     * @param root Le répertoire : les chemins relatifs y sont résolus, et un chemin
+     *             qui en sort (.., lien symbolique) est refusé ; vide pour refuser
+     *             toute instruction de fichier
+     * @throw std::runtime_error si le répertoire n'existe pas
+     */
+    void restrictFiles(const std::string& root);
     
 private:
-    // Évaluateur ExprTk sous-jacent
-    std::unique_ptr<ExprTkEvaluator> evaluator_;
+    // Instruction compilée et état d'exécution associé
+    struct CompiledStatement {
+        std::string text;
+        std::shared_ptr<const Program> program;
+        VirtualMachine::Frame frame;
+    };
+    
+    // Exécute [nom =] expression par l'évaluateur natif ; valeur vide si l'expression sort de sa grammaire
+    Value evaluateNative(const std::string& input);
     
-    // Traite une assignation de variable (avec =)
-    std::shared_ptr<IValue> processAssignment(const std::string& input);
+    // Exécute save(expression, "fichier"), [nom =] load("fichier") ou [nom =] readcsv("fichier")
+    Value evaluateFileStatement(const std::string& input);
     
-    // Traite une création de vecteur (avec [])
-    std::shared_ptr<IValue> processVectorCreation(const std::string& input);
+    // Chemin effectif d'un fichier, vérifié si les fichiers sont restreints (restrictFiles)
+    std::string resolvePath(const std::string& path) const;
     
-    // Traite une création de matrice (avec [])
-    std::shared_ptr<IValue> processMatrixCreation(const std::string& input);
+    // Retourne l'instruction compilée (depuis le cache ou après compilation)
+    CompiledStatement& lookup(const std::string& input);
     
-    // Vérifie si une entrée est une assignation
-    bool isAssignment(const std::string& input) const;
+    // Compile une instruction pour les variables courantes et la publie dans le cache partagé
+    std::shared_ptr<const Program> compile(const std::string& input);
     
-    // Vérifie si une entrée est une création de vecteur
-    bool isVectorCreation(const std::string& input) const;
+    // Évaluateur sous-jacent (environnement des variables, expressions hors du bytecode)
+    EvaluatorType evaluatorType_;
+    std::shared_ptr<IExpressionEvaluator> evaluator_;
     
-    // Vérifie si une entrée est une création de matrice
-    bool isMatrixCreation(const std::string& input) const;
+    std::unique_ptr<BytecodeCompiler> compiler_;
+    std::unique_ptr<VirtualMachine> machine_;
     
-    // Extrait le nom de la variable et l'expression d'une assignation
-    std::pair<std::string, std::string> parseAssignment(const std::string& input) const;
+    // Programmes compilés, partagés avec les autres sessions
+    std::shared_ptr<ProgramCache> programs_;
     
-    // Extrait les éléments d'un vecteur ou d'une matrice
-    std::vector<std::string> parseVectorElements(const std::string& input) const;
+    // Cache LRU des instructions de la session (programme et Frame) : la liste est ordonnée du plus récent au plus ancien,
+    // l'index référence les textes stockés dans les nœuds de la liste
+    std::list<CompiledStatement> statements_;
+    std::unordered_map<std::string_view, std::list<CompiledStatement>::iterator> statementIndex_;
     
-    // Extrait les dimensions d'une matrice
-    std::pair<size_t, size_t> parseMatrixDimensions(const std::string& input) const;
+    CsvStats lastImport_;
     
-    // Expressions régulières pour la détection des patterns
-    std::regex assignmentRegex_;
-    std::regex vectorRegex_;
-    std::regex matrixRegex_;
-    std::regex scalarMatrixOpRegex_;
-    std::regex matrixScalarOpRegex_;
+    // Répertoire autorisé (canonique) si filesRestricted_, vide : aucun fichier
+    bool filesRestricted_ = false;
+    std::string fileRoot_;
 };
 
 } // namespace FusioCore 
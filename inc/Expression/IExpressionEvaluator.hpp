@@ -2,11 +2,19 @@
 #define IEXPRESSIONEVALUATOR_HPP
 
 #include <string>
-#include <memory>
-#include "Value/Value.hpp"
+#include <vector>
+#include "Value/Variant.hpp"
 
 namespace FusioCore {
 
+/**
+ * Colonne d'une évaluation par lots : à la ligne i, la variable name vaut values[i]
+ */
+struct BatchColumn {
+    std::string name;
+    Eigen::Ref<const Eigen::VectorXd> values;  // Référencée sans copie, le temps de l'évaluation
+};
+
 /**
  * Interface pour l'évaluation d'expressions mathématiques
  */
@@ -20,7 +28,7 @@ public:
      * @return Le résultat de l'évaluation
      * @throw std::runtime_error si l'expression est invalide
      */
-    virtual std::shared_ptr<IValue> evaluate(const std::string& expression) = 0;
+    virtual Value evaluate(const std::string& expression) = 0;
     
     /**
      * Vérifie si une expression est valide
@@ -29,19 +37,34 @@ public:
      */
     virtual bool isValid(const std::string& expression) = 0;
     
+    /**
+     * Évalue une formule scalaire sur chaque ligne d'un ensemble de colonnes
+     *
+     * La formule est compilée une seule fois, puis exécutée sur toutes les
+     * lignes ; les variables qui ne sont pas des colonnes sont lues dans
+     * l'environnement.
+     * @param expression La formule
+     * @param columns Les colonnes, toutes de même taille
+     * @return Le résultat de chaque ligne
+     * @throw std::runtime_error si la formule est invalide, s'il n'y a aucune
+     *        colonne ou si leurs tailles diffèrent
+     */
+    virtual Vector evaluateBatch(const std::string& expression, const std::vector<BatchColumn>& columns) = 0;
+    
     /**
      * Définit une variable dans l'environnement d'évaluation
      * @param name Le nom de la variable
-     * @param value La valeur de la variable
+     * @param value La valeur de la variable (prise par valeur : un temporaire est déplacé)
      */
-    virtual void setVariable(const std::string& name, const std::shared_ptr<IValue>& value) = 0;
+    virtual void setVariable(const std::string& name, Value value) = 0;
     
     /**
      * Obtient la valeur d'une variable
      * @param name Le nom de la variable
-     * @return La valeur de la variable, ou nullptr si elle n'existe pas
+     * @return La valeur de la variable, sans copie, ou nullptr si elle n'existe pas ;
+     *         le pointeur reste valide tant que la variable n'est pas supprimée
      */
-    virtual std::shared_ptr<IValue> getVariable(const std::string& name) = 0;
+    virtual Value* getVariable(const std::string& name) = 0;
     
     /**
      * Supprime une variable de l'environnement d'évaluation
@@ -0,0 +1,91 @@
+#ifndef LEXER_HPP
+#define LEXER_HPP
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace FusioCore {
+
+/**
+ * Types de lexèmes reconnus par le moteur natif
+ */
+enum class TokenType {
+    Number,      // 3, 2.5, 1e-3
+    Identifier,  // A, x1, sin
+    Plus,        // +
+    Minus,       // -
+    Star,        // *
+    Slash,       // /
+    Backslash,   // \ (résolution de système)
+    Caret,       // ^
+    DotStar,     // .*
+    DotSlash,    // ./
+    DotCaret,    // .^
+    Apostrophe,  // ' (transposée)
+    LParen,      // (
+    RParen,      // )
+    Comma,       // ,
+    Semicolon,   // ; (séparateur de lignes d'un littéral)
+    Colon,       // : (plage d'indices)
+    LBracket,    // [
+    RBracket,    // ]
+    End          // Fin de l'entrée
+};
+
+/**
+ * Lexème : type, texte source et valeur numérique éventuelle
+ */
+struct Token {
+    TokenType type = TokenType::End;
+    std::string text;
+    double number = 0.0;
+    size_t position = 0;
+    bool spaceBefore = false;  // Précédé d'un blanc (séparateur d'éléments entre crochets)
+};
+
+/**
+ * Erreur de syntaxe levée par le lexer ou le parser natif
+ */
+class SyntaxError : public std::runtime_error {
+public:
+    using std::runtime_error::runtime_error;
+};
+
+/**
+ * Découpe une expression en lexèmes
+ *
+ * Les lexèmes sont produits à la demande : le Parser lit l'entrée en une
+ * seule passe, sans matérialiser la liste complète (littéraux volumineux).
+ */
+class Lexer {
+public:
+    /**
+     * @param source L'expression à découper (doit survivre au Lexer)
+     */
+    explicit Lexer(const std::string& source);
+    
+    /**
+     * Produit le lexème suivant
+     * @return Le lexème suivant, TokenType::End une fois l'entrée épuisée
+     * @throw SyntaxError si un caractère n'appartient pas à la grammaire native
+     */
+    Token next();
+    
+    /**
+     * Découpe l'expression en lexèmes (le dernier est toujours TokenType::End)
+     * @param source L'expression à découper
+     * @return La liste des lexèmes
+     * @throw SyntaxError si un caractère n'appartient pas à la grammaire native
+     */
+    static std::vector<Token> tokenize(const std::string& source);
+    
+private:
+    const std::string& source_;
+    size_t position_ = 0;
+    TokenType previous_ = TokenType::End;  // Type du dernier lexème produit
+};
+
+} // namespace FusioCore
+
+#endif // LEXER_HPP
@@ -0,0 +1,125 @@
+#ifndef NATIVE_EVALUATOR_HPP
+#define NATIVE_EVALUATOR_HPP
+
+#include "Expression/Ast.hpp"
+#include "Expression/IExpressionEvaluator.hpp"
+#include <list>
+#include <map>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace FusioCore {
+
+/**
+ * Évaluateur natif : expressions de la grammaire du Parser, évaluées sur les
+ * valeurs (scalaires, vecteurs, matrices, matrices creuses) sans ExprTk
+ *
+ * Une expression est analysée une fois puis traduite en une suite
+ * d'instructions conservée dans un cache :
+ * - repliement des constantes : une opération dont tous les opérandes sont
+ *   constants est calculée à la compilation ;
+ * - élimination des sous-expressions communes : deux sous-arbres identiques
+ *   (mêmes opérations sur les mêmes opérandes) partagent une instruction,
+ *   exécutée une seule fois par évaluation.
+ * Les variables sont lues à l'exécution : une expression compilée reste
+ * valide quand leurs valeurs changent.
+ *
+ * Sous-ensemble de la grammaire native pris en charge :
+ * - opérateurs + - * / \ ^ .* ./ .^ et transposition, avec les règles de
+ *   type et de dimensions du BytecodeCompiler (BytecodeCompiler::typeBinary),
+ *   dont A ^ -k calculé sur l'inverse de A comme par la VM ;
+ * - fonctions de BytecodeCompiler::lookupFunction avec les mêmes nombres
+ *   d'arguments : solve(A, b), sparse(A), sparse(m, n), sparse(i, j, v, m, n),
+ *   cg(A, b [, tol [, maxit]]), bicgstab(A, b [, tol [, maxit]]), les autres
+ *   fonctions à un argument ;
+ * - littéraux [a, b; c, d].
+ * Les indexations A(i, j) et les expressions hors de la grammaire native
+ * (comparaisons, fonctions ExprTk) sont invalides. Les opérations élément
+ * par élément (.* ./ .^, fonctions) sont calculées en double.
+ */
+class NativeEvaluator : public IExpressionEvaluator {
+public:
+    // Capacité par défaut du cache d'expressions compilées
+    static constexpr size_t DEFAULT_CACHE_CAPACITY = 256;
+    
+    explicit NativeEvaluator(size_t cacheCapacity = DEFAULT_CACHE_CAPACITY);
+    ~NativeEvaluator() override;
+    
+    Value evaluate(const std::string& expression) override;
+    bool isValid(const std::string& expression) override;
+    
+    /**
+     * Seules les formules vectorisables (BatchProgram) sont acceptées
+     * @throw std::runtime_error pour une autre formule
+     */
+    Vector evaluateBatch(const std::string& expression, const std::vector<BatchColumn>& columns) override;
+    void setVariable(const std::string& name, Value value) override;
+    Value* getVariable(const std::string& name) override;
+    void removeVariable(const std::string& name) override;
+    void clearVariables() override;
+
+private:
+    enum class OpKind {
+        Constant,   // Valeur calculée à la compilation
+        Variable,   // Variable de l'environnement, lue à l'exécution
+        Unary,
+        Binary,
+        Transpose,
+        Call,
+        Literal     // Littéral [a, b; c, d] dont certains éléments sont calculés
+    };
+    
+    struct Instruction {
+        OpKind kind = OpKind::Constant;
+        UnaryOp unaryOp = UnaryOp::Plus;
+        BinaryOp binaryOp = BinaryOp::Add;
+        FunctionId function = FunctionId::Unknown;
+        std::vector<int> operands;     // Instructions lues (arguments, éléments calculés d'un littéral)
+        Value constant;                // OpKind::Constant
+        const Value* variable = nullptr;  // OpKind::Variable (nœud stable de variables_)
+        const AstNode* literal = nullptr; // OpKind::Literal : forme et éléments constants (dans Compiled::root)
+    };
+    
+    // Expression compilée : instructions en ordre d'exécution, la dernière donne le résultat
+    struct Compiled {
+        AstPtr root;  // Arbre conservé pour les littéraux
+        std::vector<Instruction> instructions;
+        int result = -1;
+    };
+    
+    using CacheEntry = std::pair<std::string, Compiled>;
+    
+    // Retourne l'expression compilée (depuis le cache ou après compilation)
+    // @throw std::runtime_error si l'expression est invalide
+    const Compiled& compile(const std::string& expression);
+    
+    // Traduit un nœud, retourne l'indice de son instruction
+    int translate(const AstNode& node, Compiled& compiled,
+                  std::unordered_map<std::string, int>& signatures);
+    
+    // Ajoute une instruction, repliée si ses opérandes sont constants,
+    // partagée si une instruction identique existe déjà
+    int emit(Instruction instruction, Compiled& compiled, std::unordered_map<std::string, int>& signatures);
+    
+    // Exécute une instruction sur ses opérandes
+    static Value execute(const Instruction& instruction, const std::vector<const Value*>& operands);
+    
+    // Libère les expressions compilées (après suppression de variables)
+    void dropCompiledExpressions();
+    
+    // Cache LRU : la liste est ordonnée du plus récent au plus ancien,
+    // l'index référence les clés stockées dans les nœuds de la liste
+    std::list<CacheEntry> cacheEntries_;
+    std::unordered_map<std::string_view, std::list<CacheEntry>::iterator> cacheIndex_;
+    size_t cacheCapacity_;
+    
+    // Variables (les nœuds de std::map ne sont jamais déplacés : les
+    // expressions compilées et getVariable y gardent un pointeur)
+    std::map<std::string, Value> variables_;
+};
+
+} // namespace FusioCore
+
+#endif // NATIVE_EVALUATOR_HPP
@@ -0,0 +1,73 @@
+#ifndef PARSER_HPP
+#define PARSER_HPP
+
+#include "Expression/Ast.hpp"
+#include "Expression/Lexer.hpp"
+#include <deque>
+#include <string>
+
+namespace FusioCore {
+
+/**
+ * Parser de Pratt produisant l'arbre syntaxique d'une expression
+ *
+ * Priorités (de la plus faible à la plus forte) :
+ * + -, puis * / .* ./, puis - unaire, puis ^ .^ (associatifs à droite),
+ * puis la transposée postfixe '.
+ *
+ * Les arguments d'un appel peuvent être des plages (`first:last`,
+ * `first:step:last`, `:`) : `A(1:100, :)` est une indexation si A est une
+ * variable, ce que seul le typage détermine.
+ *
+ * Entre crochets, les éléments sont séparés par des virgules ou des blancs et
+ * les lignes par des points-virgules : `[1 -2]` compte deux éléments, alors
+ * que `[1 - 2]` et `[1-2]` n'en comptent qu'un.
+ */
+class Parser {
+public:
+    /**
+     * Analyse une expression complète
+     * @param source L'expression à analyser
+     * @return La racine de l'arbre syntaxique
+     * @throw SyntaxError si l'expression n'appartient pas à la grammaire native
+     */
+    static AstPtr parse(const std::string& source);
+    
+private:
+    explicit Parser(const std::string& source);
+    
+    // Analyse une expression dont les opérateurs ont une priorité > minPrecedence
+    AstPtr parseExpression(int minPrecedence);
+    
+    // Analyse un opérande préfixe (nombre, variable, appel, parenthèses, unaire, littéral)
+    AstPtr parsePrefix();
+    
+    // Analyse un littéral [a, b; c, d] (le crochet ouvrant est consommé)
+    AstPtr parseLiteral(const Token& open);
+    
+    // Consomme un élément de littéral réduit à un nombre signé, false (rien consommé) sinon
+    bool parseConstantElement(double& value);
+    
+    // Analyse un argument d'appel : expression ou plage d'indices
+    AstPtr parseArgument();
+    
+    // Analyse une expression entre parenthèses, où les blancs ne séparent plus d'éléments
+    AstPtr parseGrouped();
+    
+    // Indique si le lexème à offset commence un nouvel élément de littéral
+    bool startsElement(size_t offset = 0);
+    
+    // Lexème à offset du lexème courant, lu à la demande
+    const Token& peek(size_t offset = 0);
+    Token advance();
+    void expect(TokenType type, const char* what);
+    
+    const std::string& source_;
+    Lexer lexer_;
+    std::deque<Token> lookahead_;  // Lexèmes lus et non consommés, le courant en tête
+    bool inBrackets_ = false;  // Les blancs séparent les éléments d'un littéral
+};
+
+} // namespace FusioCore
+
+#endif // PARSER_HPP
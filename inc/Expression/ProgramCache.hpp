@@ -0,0 +1,90 @@
+#ifndef PROGRAM_CACHE_HPP
+#define PROGRAM_CACHE_HPP
+
+#include "Expression/Bytecode.hpp"
+#include "Expression/ExpressionEvaluatorFactory.hpp"
+#include <list>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace FusioCore {
+
+/**
+ * Programmes compilés partagés entre sessions
+ *
+ * Un Program est immuable : plusieurs sessions (FusioInterpreter), chacune
+ * dans son thread et avec ses propres variables, exécutent le même programme
+ * avec leur propre Frame. Une instruction peut avoir plusieurs
+ * spécialisations (types ou dimensions différents des variables lues) ; la
+ * session retient la première dont les gardes acceptent son environnement.
+ * Un programme qui confie des expressions à l'évaluateur de la session
+ * (Program::sources) n'est visible que des sessions du même type
+ * d'évaluateur : ExprTk accepte des expressions que l'évaluateur natif
+ * refuse. Les autres programmes n'en dépendent pas et sont partagés par
+ * toutes les sessions.
+ *
+ * Les lectures se font sous verrou partagé, les publications sous verrou
+ * exclusif. Les instructions les plus anciennement publiées sont évincées
+ * au-delà de la capacité.
+ */
+class ProgramCache {
+public:
+    // Nombre d'instructions conservées par défaut
+    static constexpr size_t DEFAULT_CAPACITY = 1024;
+    
+    // Nombre maximal de spécialisations conservées par instruction
+    static constexpr size_t MAX_SPECIALIZATIONS = 4;
+    
+    explicit ProgramCache(size_t capacity = DEFAULT_CAPACITY);
+    
+    ProgramCache(const ProgramCache&) = delete;
+    ProgramCache& operator=(const ProgramCache&) = delete;
+    
+    /**
+     * Spécialisations compilées d'une instruction, exécutables par une session
+     * @param statement Le texte de l'instruction
+     * @param evaluator Le type d'évaluateur de la session
+     * @return Les programmes sans expressions confiées à l'évaluateur, et ceux
+     *         compilés pour ce type d'évaluateur, du plus récent au plus ancien (vide si aucun)
+     */
+    std::vector<std::shared_ptr<const Program>> find(const std::string& statement, EvaluatorType evaluator) const;
+    
+    /**
+     * Publie une spécialisation, visible ensuite par les sessions qui peuvent l'exécuter (voir find)
+     * @param statement Le texte de l'instruction
+     * @param evaluator Le type d'évaluateur de la session qui l'a compilée
+     * @param program Le programme compilé
+     */
+    void publish(const std::string& statement, EvaluatorType evaluator, std::shared_ptr<const Program> program);
+    
+    size_t size() const;
+    void clear();
+
+private:
+    struct Specialization {
+        EvaluatorType evaluator;
+        std::shared_ptr<const Program> program;
+    };
+    
+    struct Entry {
+        std::string text;
+        std::vector<Specialization> programs;
+    };
+    
+    size_t capacity_;
+    
+    mutable std::shared_mutex mutex_;
+    
+    // Ordre de publication, du plus récent au plus ancien ; l'index
+    // référence les textes stockés dans les nœuds de la liste
+    std::list<Entry> entries_;
+    std::unordered_map<std::string_view, std::list<Entry>::iterator> index_;
+};
+
+} // namespace FusioCore
+
+#endif // PROGRAM_CACHE_HPP
@@ -0,0 +1,84 @@
+#ifndef VIRTUAL_MACHINE_HPP
+#define VIRTUAL_MACHINE_HPP
+
+#include "Expression/Bytecode.hpp"
+#include "Expression/IExpressionEvaluator.hpp"
+#include <Eigen/Dense>
+#include <optional>
+#include <vector>
+
+namespace FusioCore {
+
+/**
+ * Machine virtuelle à registres exécutant les programmes du BytecodeCompiler
+ *
+ * Avant chaque exécution, les gardes du programme sont vérifiées et les
+ * registres des variables liés à leurs données, sans copie. Les temporaires
+ * sont conservés dans le Frame : une instruction réexécutée (boucle, script)
+ * ne réalloue que la valeur qu'elle retourne. `A \ b`, `inv(A)`, `det(A)`
+ * et `A^-k` réutilisent les décompositions conservées par la variable A.
+ * Une sous-matrice ou une transposée de variable est retournée comme une vue
+ * sur ses éléments (Program::view) ; une variable vue, liée à un registre,
+ * est d'abord rendue contiguë.
+ */
+class VirtualMachine {
+public:
+    /**
+     * État d'exécution d'un programme, réutilisé d'une exécution à l'autre
+     */
+    struct Frame {
+        std::vector<Eigen::MatrixXd> storage;          // Stockage des registres temporaires
+        std::vector<double*> data;                     // Données de chaque registre
+        std::vector<Value*> bound;                     // Variables liées pendant l'exécution (environnement)
+        std::vector<const SparseMatrix*> sparse;       // Valeurs des registres creux
+        std::vector<std::optional<SparseMatrix>> sparseStorage;  // Registres creux temporaires
+        std::vector<const double*> inputs;             // Entrées d'un programme fusionné
+        std::vector<double> scalars;                   // Scalaires d'un programme fusionné
+        std::vector<int> widened;                      // Registres convertis en double pour l'exécution en cours
+    };
+    
+    /**
+     * @param variables L'évaluateur qui détient l'environnement des variables
+     */
+    explicit VirtualMachine(IExpressionEvaluator& variables);
+    
+    /**
+     * Exécute un programme ; une assignation met à jour sa variable cible
+     * @param program Le programme à exécuter
+     * @param frame L'état d'exécution associé au programme
+     * @return Le résultat, ou une valeur vide si une garde échoue (programme à recompiler)
+     * @throw std::runtime_error si le calcul échoue (matrice non inversible, ...)
+     */
+    Value execute(const Program& program, Frame& frame);
+
+private:
+    using MatrixOut = Eigen::Map<Eigen::MatrixXd>;
+    using ConstMatrixMap = Eigen::Map<const Eigen::MatrixXd>;
+    
+    // Vérifie les gardes et lie les variables, false si une garde échoue
+    bool bind(const Program& program, Frame& frame);
+    
+    // Exécute une instruction
+    void step(const Program& program, Frame& frame, const Instruction& instruction);
+    
+    // Décompositions d'un registre : celles conservées par une variable
+    // matrice, sinon calculées dans local
+    const Eigen::PartialPivLU<Eigen::MatrixXd>& luOf(
+        const Program& program, Frame& frame, int reg,
+        std::optional<Eigen::PartialPivLU<Eigen::MatrixXd>>& local);
+    const Eigen::PartialPivLU<Eigen::MatrixXd>& invertibleLuOf(
+        const Program& program, Frame& frame, int reg,
+        std::optional<Eigen::PartialPivLU<Eigen::MatrixXd>>& local);
+    const Eigen::ColPivHouseholderQR<Eigen::MatrixXd>& qrOf(
+        const Program& program, Frame& frame, int reg,
+        std::optional<Eigen::ColPivHouseholderQR<Eigen::MatrixXd>>& local);
+    
+    // Matrice liée à un registre variable, nullptr sinon
+    const Matrix* matrixVariable(const Program& program, const Frame& frame, int reg) const;
+    
+    IExpressionEvaluator& variables_;
+};
+
+} // namespace FusioCore
+
+#endif // VIRTUAL_MACHINE_HPP
@@ -0,0 +1,60 @@
+#ifndef CSV_READER_HPP
+#define CSV_READER_HPP
+
+#include "Value/Value.hpp"
+#include <cstddef>
+#include <string>
+
+namespace FusioCore {
+
+/**
+ * Statistiques d'une importation
+ */
+struct CsvStats {
+    Eigen::Index rows = 0;
+    Eigen::Index cols = 0;
+    size_t bytes = 0;       // Taille du fichier
+    double seconds = 0.0;   // Durée totale (projection, découpage, analyse)
+    size_t threads = 1;     // Threads du pool utilisés pour l'analyse
+    bool header = false;    // La première ligne était un en-tête
+    
+    // Débit d'analyse en octets par seconde
+    double throughput() const;
+};
+
+/**
+ * Importation de fichiers CSV/TSV numériques dans une matrice
+ *
+ * Le fichier est projeté en mémoire puis découpé en blocs d'environ
+ * CHUNK_SIZE octets, alignés sur les fins de ligne. Un premier passage
+ * parallèle compte les lignes de chaque bloc, ce qui fixe la ligne de
+ * départ de chacun et les dimensions de la matrice, allouée une seule fois ;
+ * un second passage analyse les blocs en parallèle (std::from_chars) et
+ * écrit directement dans la matrice.
+ *
+ * - Séparateur : ',', ';' ou tabulation, le plus fréquent sur la première ligne.
+ * - En-tête : la première ligne est ignorée si l'un de ses champs n'est pas
+ *   numérique (les noms de colonnes ne sont pas conservés).
+ * - Valeurs manquantes : un champ vide, NA, N/A, null ou NaN donne NaN.
+ * - Les lignes vides sont ignorées ; les espaces et guillemets autour d'un
+ *   champ sont retirés.
+ */
+class CsvReader {
+public:
+    // Taille visée des blocs analysés par un même thread
+    static constexpr size_t CHUNK_SIZE = 1 << 20;
+    
+    /**
+     * Lit un fichier CSV/TSV
+     * @param path Le chemin du fichier
+     * @param stats Reçoit les dimensions et le débit de l'importation
+     * @return La matrice lue
+     * @throw std::runtime_error si le fichier est illisible ou si une ligne
+     *        est mal formée (nombre de champs, valeur non numérique)
+     */
+    static Matrix read(const std::string& path, CsvStats& stats);
+};
+
+} // namespace FusioCore
+
+#endif // CSV_READER_HPP
@@ -0,0 +1,41 @@
+#ifndef MAPPED_FILE_HPP
+#define MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace FusioCore {
+
+/**
+ * Fichier projeté en mémoire, en lecture
+ *
+ * La projection est en lecture seule : le fichier n'est jamais modifié, les
+ * pages ne sont lues qu'au premier accès et ne comptent pas dans la mémoire
+ * engagée (un fichier plus grand que la mémoire se projette). Sans mmap
+ * (Windows), le fichier est lu entièrement en mémoire.
+ */
+class MappedFile {
+public:
+    /**
+     * @param path Le chemin du fichier
+     * @throw std::runtime_error si le fichier ne peut pas être ouvert ou projeté
+     */
+    explicit MappedFile(const std::string& path);
+    ~MappedFile();
+    
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    
+    const char* data() const;
+    size_t size() const;
+
+private:
+    char* data_ = nullptr;
+    size_t size_ = 0;
+    std::vector<char> buffer_;  // Contenu lu, sans mmap
+};
+
+} // namespace FusioCore
+
+#endif // MAPPED_FILE_HPP
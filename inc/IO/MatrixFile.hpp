@@ -0,0 +1,70 @@
+#ifndef MATRIX_FILE_HPP
+#define MATRIX_FILE_HPP
+
+#include "Value/Variant.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace FusioCore {
+
+/**
+ * Fichiers binaires .fmat (scalaire, vecteur ou matrice)
+ *
+ * En-tête de 64 octets, entiers petit-boutistes :
+ *   0   magic "FUSIOMAT"
+ *   8   uint32 version (1)
+ *   12  uint32 type des éléments (1 : float64, 2 : float32, 3 : int32, 4 : int64 ; scalaire : float64)
+ *   16  uint32 nature (0 : scalaire, 1 : vecteur, 2 : matrice)
+ *   20  uint32 réservé (0)
+ *   24  uint64 nombre de lignes
+ *   32  uint64 nombre de colonnes
+ *   40  uint64 position du contenu (multiple de ALIGNMENT)
+ *   48  réservé (0) jusqu'à 64
+ * Le contenu suit, en ordre colonne, précédé du remplissage d'alignement.
+ *
+ * Le chargement d'une matrice projette le fichier en mémoire et la matrice
+ * référence directement son contenu : seules les pages lues sont chargées,
+ * et une matrice plus grande que la mémoire disponible peut être ouverte.
+ * Les éléments sont enregistrés et relus dans leur type (dtype).
+ */
+class MatrixFile {
+public:
+    static constexpr uint32_t VERSION = 1;
+    
+    // Alignement du contenu (ligne de cache, compatible SIMD)
+    static constexpr size_t ALIGNMENT = 64;
+    
+    /**
+     * Enregistre une valeur
+     * Le fichier est écrit à côté puis renommé : une matrice chargée depuis
+     * le même chemin conserve son contenu.
+     * @param path Le chemin du fichier
+     * @param value La valeur à enregistrer
+     * @throw std::runtime_error si le fichier ne peut pas être écrit
+     */
+    static void save(const std::string& path, const Value& value);
+    
+    /**
+     * Charge une valeur
+     * @param path Le chemin du fichier
+     * @return Le scalaire, le vecteur ou la matrice (projetée) enregistré
+     * @throw std::runtime_error si le fichier est illisible, tronqué ou d'une version inconnue
+     */
+    static Value load(const std::string& path);
+    
+    // Code du type des éléments dans l'en-tête (aussi utilisé par le protocole du serveur)
+    static uint32_t dtypeCode(DType dtype);
+    
+    /**
+     * Vérifie que la machine est petit-boutiste : les entiers et les éléments
+     * des fichiers .fmat et du protocole du serveur sont copiés tels quels
+     * @param feature Ce qui requiert cet ordre des octets, en tête du message d'erreur
+     * @throw std::runtime_error sur une architecture gros-boutiste
+     */
+    static void requireLittleEndian(const std::string& feature);
+};
+
+} // namespace FusioCore
+
+#endif // MATRIX_FILE_HPP
@@ -0,0 +1,82 @@
+#ifndef VECTOR_MATH_HPP
+#define VECTOR_MATH_HPP
+
+#include <cstddef>
+
+namespace FusioCore {
+
+/**
+ * Jeux d'instructions disponibles pour les noyaux vectorisés
+ */
+enum class SimdLevel {
+    Scalar,  // Code portable, une valeur à la fois
+    SSE2,    // 2 doubles par instruction
+    AVX2,    // 4 doubles par instruction
+    AVX512   // 8 doubles par instruction
+};
+
+/**
+ * Noyaux mathématiques élément par élément sur des tableaux de doubles
+ *
+ * Le jeu d'instructions est choisi à l'exécution selon le processeur (le plus
+ * large disponible), et peut être imposé par la variable d'environnement
+ * FUSIO_SIMD (scalar, sse2, avx2, avx512) ou par setLevel().
+ *
+ * Contrat de précision (erreur maximale par rapport au résultat exact,
+ * en ULP) :
+ * - sqrt : arrondi correct (0,5 ULP).
+ * - exp : 1 ULP sur [-708, 708].
+ * - log : 1 ULP pour tout x > 0 fini, sous-normaux compris.
+ * - log10 : 2 ULP pour tout x > 0 fini.
+ * - sin, cos, tan : 1 ULP pour |x| <= 8e5, multiples de pi/2 compris
+ *   (réduction de Cody-Waite en quatre termes, reste en double-double).
+ * Ces bornes sont vérifiées par BM_VectorMathAccuracy (bench/), par rapport
+ * à la bibliothèque C en long double, à tous les jeux d'instructions.
+ * Hors de ces domaines (débordements, zéros, négatifs, infinis, NaN, grands
+ * arguments trigonométriques), l'élément est calculé par la bibliothèque C.
+ *
+ * Tous les niveaux exécutent les mêmes opérations IEEE dans le même ordre
+ * (sans contraction FMA) : les résultats sont identiques bit à bit quel que
+ * soit le jeu d'instructions retenu. Sans extensions vectorielles (MSVC), seul
+ * le niveau scalaire existe et délègue à la bibliothèque C.
+ *
+ * x et out peuvent désigner le même tableau.
+ */
+class VectorMath {
+public:
+    using Kernel = void (*)(const double* x, double* out, size_t n);
+    
+    static void sin(const double* x, double* out, size_t n);
+    static void cos(const double* x, double* out, size_t n);
+    static void tan(const double* x, double* out, size_t n);
+    static void exp(const double* x, double* out, size_t n);
+    static void log(const double* x, double* out, size_t n);
+    static void log10(const double* x, double* out, size_t n);
+    static void sqrt(const double* x, double* out, size_t n);
+    
+    /**
+     * Retourne le jeu d'instructions actuellement utilisé
+     */
+    static SimdLevel level();
+    
+    /**
+     * Retourne le jeu d'instructions le plus large supporté par le processeur et la compilation
+     */
+    static SimdLevel detectLevel();
+    
+    /**
+     * Impose un jeu d'instructions (ramené au plus large supporté)
+     * @param level Le niveau souhaité
+     * @return Le niveau effectivement retenu
+     */
+    static SimdLevel setLevel(SimdLevel level);
+    
+    /**
+     * Retourne le nom d'un jeu d'instructions ("scalar", "sse2", "avx2", "avx512")
+     */
+    static const char* levelName(SimdLevel level);
+};
+
+} // namespace FusioCore
+
+#endif // VECTOR_MATH_HPP
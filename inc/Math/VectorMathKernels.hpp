@@ -0,0 +1,461 @@
+#ifndef VECTOR_MATH_KERNELS_HPP
+#define VECTOR_MATH_KERNELS_HPP
+
+/**
+ * Implémentation générique des noyaux de VectorMath (en-tête interne)
+ *
+ * Les noyaux sont écrits une seule fois avec les extensions vectorielles de
+ * GCC/Clang, pour une largeur W (en doubles) choisie par l'unité de
+ * compilation qui les instancie : VectorMath.cpp (W = 1), puis
+ * VectorMathSSE2.cpp, VectorMathAVX2.cpp et VectorMathAVX512.cpp compilées
+ * avec les options du jeu d'instructions correspondant.
+ *
+ * Les algorithmes et coefficients sont ceux de fdlibm : réduction
+ * d'argument de Cody-Waite puis approximations polynomiales minimax.
+ */
+
+#include "Math/VectorMath.hpp"
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+namespace FusioCore {
+
+/**
+ * Table des noyaux d'un jeu d'instructions
+ */
+struct VectorMathTable {
+    VectorMath::Kernel sin;
+    VectorMath::Kernel cos;
+    VectorMath::Kernel tan;
+    VectorMath::Kernel exp;
+    VectorMath::Kernel log;
+    VectorMath::Kernel log10;
+    VectorMath::Kernel sqrt;
+};
+
+// Tables fournies par chaque unité de compilation
+const VectorMathTable& vectorMathTableScalar();
+const VectorMathTable& vectorMathTableSSE2();
+const VectorMathTable& vectorMathTableAVX2();
+const VectorMathTable& vectorMathTableAVX512();
+
+#if defined(__GNUC__)
+
+namespace VectorMathKernels {
+
+// Espace anonyme : chaque unité de compilation possède sa propre copie,
+// compilée pour son jeu d'instructions, sans partage de symboles à l'édition de liens
+namespace {
+
+// Réduction d'argument
+constexpr double SHIFT = 6755399441055744.0;              // 1.5 * 2^52 : arrondi à l'entier le plus proche
+constexpr double INV_LN2 = 1.44269504088896338700e+00;
+constexpr double LN2_HI = 6.93147180369123816490e-01;     // 32 bits de poids fort de ln(2)
+constexpr double LN2_LO = 1.90821492927058770002e-10;
+constexpr double TWO_OVER_PI = 6.36619772367581382433e-01;
+constexpr double PIO2_1 = 1.57079632673412561417e+00;     // pi/2 découpé en trois termes de 33 bits et un reste
+constexpr double PIO2_2 = 6.07710050630396597660e-11;
+constexpr double PIO2_3 = 2.02226624871116645580e-21;
+constexpr double PIO2_3T = 8.47842766036889956997e-32;   // reste de pi/2 - PIO2_1 - PIO2_2 - PIO2_3
+constexpr double IVLN10 = 4.34294481903251816668e-01;
+constexpr double LOG10_2_HI = 3.01029995663611771306e-01;
+constexpr double LOG10_2_LO = 3.69423907715893078616e-13;
+constexpr double SQRT2 = 1.41421356237309504880;
+constexpr double TWO54 = 1.80143985094819840000e+16;
+constexpr double MIN_NORMAL = 2.2250738585072014e-308;
+constexpr double MAX_FINITE = 1.7976931348623157e+308;
+
+// Domaines du chemin vectoriel (voir le contrat de VectorMath)
+constexpr double EXP_LIMIT = 708.0;
+constexpr double TRIG_LIMIT = 8.0e5;
+
+// exp : approximation rationnelle de Remez sur [-ln2/2, ln2/2]
+constexpr double P1 = 1.66666666666666019037e-01;
+constexpr double P2 = -2.77777777770155933842e-03;
+constexpr double P3 = 6.61375632143793436117e-05;
+constexpr double P4 = -1.65339022054652515390e-06;
+constexpr double P5 = 4.13813679705723846039e-08;
+
+// log : log(1+f) = f - f²/2 + s*(f²/2 + R(s²)), s = f/(2+f)
+constexpr double LG1 = 6.666666666666735130e-01;
+constexpr double LG2 = 3.999999999940941908e-01;
+constexpr double LG3 = 2.857142874366239149e-01;
+constexpr double LG4 = 2.222219843214978396e-01;
+constexpr double LG5 = 1.818357216161805012e-01;
+constexpr double LG6 = 1.531383769920937332e-01;
+constexpr double LG7 = 1.479819860511658591e-01;
+
+// sin/cos sur [-pi/4, pi/4]
+constexpr double S1 = -1.66666666666666324348e-01;
+constexpr double S2 = 8.33333333332248946124e-03;
+constexpr double S3 = -1.98412698298579493134e-04;
+constexpr double S4 = 2.75573137070700676789e-06;
+constexpr double S5 = -2.50507602534068634195e-08;
+constexpr double S6 = 1.58969099521155010221e-10;
+constexpr double C1 = 4.16666666666666019037e-02;
+constexpr double C2 = -1.38888888888741095749e-03;
+constexpr double C3 = 2.48015872894767294178e-05;
+constexpr double C4 = -2.75573143513906633035e-07;
+constexpr double C5 = 2.08757232129817482790e-09;
+constexpr double C6 = -1.13596475577881948265e-11;
+
+// tan sur [-0.6744, 0.6744] : tan(r) = r + r^3*T(r^2) ; au-delà, tan(pi/4 - r)
+constexpr double T0 = 3.33333333333334091986e-01;
+constexpr double T1 = 1.33333333333201242699e-01;
+constexpr double T2 = 5.39682539762260521377e-02;
+constexpr double T3 = 2.18694882948595424599e-02;
+constexpr double T4 = 8.86323982359930005737e-03;
+constexpr double T5 = 3.59207910759131235356e-03;
+constexpr double T6 = 1.45620945432529025516e-03;
+constexpr double T7 = 5.88041240820264096874e-04;
+constexpr double T8 = 2.46463134818469906812e-04;
+constexpr double T9 = 7.81794442939557092300e-05;
+constexpr double T10 = 7.14072491382608190305e-05;
+constexpr double T11 = -1.85586374855275456654e-05;
+constexpr double T12 = 2.59073051863633712884e-05;
+constexpr double PIO4 = 7.85398163397448278999e-01;
+constexpr double PIO4_LO = 3.06161699786838301793e-17;
+constexpr double TAN_BIG = 0.6744;
+
+// Types d'une voie ou d'un bloc de W voies (une voie : scalaires ordinaires)
+template <int W>
+struct Lanes {
+    typedef double Vd __attribute__((vector_size(8 * W)));
+    typedef uint64_t Vu __attribute__((vector_size(8 * W)));
+};
+
+template <>
+struct Lanes<1> {
+    typedef double Vd;
+    typedef uint64_t Vu;
+};
+
+template <int W>
+struct Kernels {
+    typedef typename Lanes<W>::Vd Vd;
+    typedef typename Lanes<W>::Vu Vu;
+
+    static Vd load(const double* p) {
+        Vd v;
+        std::memcpy(&v, p, sizeof(v));
+        return v;
+    }
+
+    static void store(double* p, Vd v) {
+        std::memcpy(p, &v, sizeof(v));
+    }
+
+    static Vu bits(Vd v) {
+        Vu u;
+        std::memcpy(&u, &v, sizeof(u));
+        return u;
+    }
+
+    static Vd fromBits(Vu u) {
+        Vd v;
+        std::memcpy(&v, &u, sizeof(v));
+        return v;
+    }
+
+    static Vd splat(double s) { return Vd{} + s; }
+
+    template <typename T>
+    static auto lane(T v, int i) {
+        if constexpr (W == 1) {
+            (void)i;
+            return v;
+        } else {
+            return v[i];
+        }
+    }
+
+    // mask ? a : b (vecteurs : tous les bits à 1 ou à 0 par voie)
+    template <typename Mask>
+    static Vd select(Mask mask, Vd a, Vd b) {
+        Vu m;
+        if constexpr (W == 1) {
+            m = mask ? ~static_cast<uint64_t>(0) : static_cast<uint64_t>(0);
+        } else {
+            m = (Vu)mask;
+        }
+        return fromBits((m & bits(a)) | (~m & bits(b)));
+    }
+
+    template <typename Mask>
+    static bool any(Mask mask) {
+        if constexpr (W == 1) {
+            return mask;
+        } else {
+            // Réduction par OU sans branchement par voie
+            uint64_t lanes[W];
+            std::memcpy(lanes, &mask, sizeof(lanes));
+            uint64_t merged = 0;
+            for (int i = 0; i < W; ++i) {
+                merged |= lanes[i];
+            }
+            return merged != 0;
+        }
+    }
+
+    /**
+     * Applique core() par blocs de W éléments. Les voies hors domaine
+     * (special() vrai) sont recalculées par la bibliothèque C. x et out
+     * peuvent désigner le même tableau.
+     */
+    template <typename Core, typename Special>
+    static void apply(const double* x, double* out, size_t n, Core core, Special special,
+                      double (*fallback)(double)) {
+        size_t i = 0;
+        for (; i + W <= n; i += W) {
+            Vd v = load(x + i);
+            Vd r = core(v);
+            auto mask = special(v);
+            store(out + i, r);
+            if (any(mask)) {
+                for (int l = 0; l < W; ++l) {
+                    if (lane(mask, l)) {
+                        out[i + l] = fallback(lane(v, l));
+                    }
+                }
+            }
+        }
+
+        // Dernier bloc incomplet : complété par une valeur neutre
+        if (i < n) {
+            double padded[W];
+            for (int l = 0; l < W; ++l) {
+                padded[l] = i + l < n ? x[i + l] : 1.0;
+            }
+            Vd v = load(padded);
+            Vd r = core(v);
+            auto mask = special(v);
+            double result[W];
+            store(result, r);
+            for (size_t l = 0; i + l < n; ++l) {
+                out[i + l] = lane(mask, static_cast<int>(l)) ? fallback(padded[l]) : result[l];
+            }
+        }
+    }
+
+    static Vd expCore(Vd x) {
+        // x = k*ln2 + r, |r| <= ln2/2
+        Vd kd = x * INV_LN2 + SHIFT;
+        Vu k = bits(kd);
+        kd = kd - SHIFT;
+        Vd hi = x - kd * LN2_HI;
+        Vd lo = kd * LN2_LO;
+        Vd r = hi - lo;
+
+        Vd z = r * r;
+        Vd c = r - z * (P1 + z * (P2 + z * (P3 + z * (P4 + z * P5))));
+        Vd y = 1.0 - ((lo - (r * c) / (2.0 - c)) - hi);
+
+        // 2^k construit dans le champ exposant (les bits de SHIFT sortent par la gauche)
+        Vu scale = (k << 52) + (static_cast<uint64_t>(1023) << 52);
+        return y * fromBits(scale);
+    }
+
+    // Décompose x = 2^k * m, sqrt(2)/2 < m <= sqrt(2) ; x > 0 fini
+    static void logReduce(Vd x, Vd& kd, Vd& f, Vd& s, Vd& hfsq, Vd& R) {
+        auto tiny = x < MIN_NORMAL;
+        x = select(tiny, x * TWO54, x);
+
+        Vu u = bits(x);
+        Vu exponent = u >> 52;
+        kd = fromBits(exponent | static_cast<uint64_t>(0x4330000000000000ULL)) - 4503599627370496.0 - 1023.0;
+        kd = kd - select(tiny, splat(54.0), splat(0.0));
+
+        Vd m = fromBits((u & static_cast<uint64_t>(0x000FFFFFFFFFFFFFULL)) | static_cast<uint64_t>(0x3FF0000000000000ULL));
+        auto big = m > SQRT2;
+        m = select(big, m * 0.5, m);
+        kd = kd + select(big, splat(1.0), splat(0.0));
+
+        f = m - 1.0;
+        s = f / (2.0 + f);
+        Vd z = s * s;
+        Vd w = z * z;
+        Vd t1 = w * (LG2 + w * (LG4 + w * LG6));
+        Vd t2 = z * (LG1 + w * (LG3 + w * (LG5 + w * LG7)));
+        R = t2 + t1;
+        hfsq = 0.5 * f * f;
+    }
+
+    static Vd logCore(Vd x) {
+        Vd kd, f, s, hfsq, R;
+        logReduce(x, kd, f, s, hfsq, R);
+        return kd * LN2_HI - ((hfsq - (s * (hfsq + R) + kd * LN2_LO)) - f);
+    }
+
+    static Vd log10Core(Vd x) {
+        Vd kd, f, s, hfsq, R;
+        logReduce(x, kd, f, s, hfsq, R);
+        Vd logm = f - (hfsq - s * (hfsq + R));
+        return kd * LOG10_2_HI + (kd * LOG10_2_LO + IVLN10 * logm);
+    }
+
+    /**
+     * Réduction trigonométrique : x = n*pi/2 + (r + y), |r| <= pi/4, q = n mod 4.
+     * Les produits par PIO2_1, PIO2_2 et PIO2_3 sont exacts (33 bits x 20 bits
+     * au plus) et le reste y conserve les bits perdus par r : la précision est
+     * préservée près des multiples de pi/2, où r s'annule.
+     */
+    static void trigReduce(Vd x, Vd& r, Vd& y, Vu& q) {
+        Vd kd = x * TWO_OVER_PI + SHIFT;
+        q = bits(kd) & static_cast<uint64_t>(3);
+        kd = kd - SHIFT;
+        Vd t = x - kd * PIO2_1;
+        Vd p2 = kd * PIO2_2;
+        Vd r1 = t - p2;
+        Vd p3 = kd * PIO2_3;
+        r = r1 - p3;
+        y = (((r1 - r) - p3) + ((t - r1) - p2)) - kd * PIO2_3T;
+    }
+
+    // sin et cos du reste r + y (__kernel_sin et __kernel_cos de fdlibm)
+    static void trigCore(Vd x, Vd& sinR, Vd& cosR, Vu& q) {
+        Vd r, y;
+        trigReduce(x, r, y, q);
+
+        Vd z = r * r;
+        Vd w = z * z;
+        Vd v = z * r;
+        Vd rs = S2 + z * (S3 + z * S4) + z * w * (S5 + z * S6);
+        sinR = r - ((z * (0.5 * y - v * rs) - y) - v * S1);
+
+        Vd rc = z * (C1 + z * (C2 + z * C3)) + w * w * (C4 + z * (C5 + z * C6));
+        Vd hz = 0.5 * z;
+        Vd oneMinus = 1.0 - hz;
+        cosR = oneMinus + (((1.0 - oneMinus) - hz) + (z * rc - r * y));
+    }
+
+    // Sélectionne sin ou cos selon le quadrant et applique le signe
+    static Vd quadrant(Vd sinR, Vd cosR, Vu q) {
+        Vd v = select((q & static_cast<uint64_t>(1)) != static_cast<uint64_t>(0), cosR, sinR);
+        return fromBits(bits(v) ^ ((q & static_cast<uint64_t>(2)) << 62));
+    }
+
+    static Vd sinCore(Vd x) {
+        Vd s, c;
+        Vu q;
+        trigCore(x, s, c, q);
+        return quadrant(s, c, q);
+    }
+
+    static Vd cosCore(Vd x) {
+        Vd s, c;
+        Vu q;
+        trigCore(x, s, c, q);
+        return quadrant(s, c, q + static_cast<uint64_t>(1));
+    }
+
+    /**
+     * tan : noyau dédié de fdlibm (__kernel_tan) plutôt que sin/cos, dont le
+     * quotient cumule trois arrondis.
+     */
+    static Vd tanCore(Vd x) {
+        Vd r, y;
+        Vu q;
+        trigReduce(x, r, y, q);
+
+        // Quadrant impair : tan(x) = -1/tan(r)
+        auto odd = (q & static_cast<uint64_t>(1)) != static_cast<uint64_t>(0);
+        Vd iy = select(odd, splat(-1.0), splat(1.0));
+
+        // |r| >= 0.6744 : tan(r) = tan(pi/4 - |r|) transformé, signe remis à la fin
+        Vu sign = bits(r) & static_cast<uint64_t>(0x8000000000000000ULL);
+        Vd ar = fromBits(bits(r) ^ sign);
+        Vd ay = fromBits(bits(y) ^ sign);
+        auto big = ar >= TAN_BIG;
+        Vd rb = (PIO4 - ar) + (PIO4_LO - ay);
+        r = select(big, rb, r);
+        y = select(big, splat(0.0), y);
+
+        Vd z = r * r;
+        Vd w = z * z;
+        Vd ro = T1 + w * (T3 + w * (T5 + w * (T7 + w * (T9 + w * T11))));
+        Vd ve = z * (T2 + w * (T4 + w * (T6 + w * (T8 + w * (T10 + w * T12)))));
+        Vd s = z * r;
+        Vd u = y + z * (s * (ro + ve) + y);
+        u = u + T0 * s;
+        Vd tn = r + u;
+
+        // Une seule division par voie : tn²/(tn + iy) si |r| est grand, -1/tn sinon
+        Vd a = select(big, tn * tn, splat(-1.0)) / select(big, tn + iy, tn);
+        Vd bigResult = iy - 2.0 * (r - (a - u));
+        bigResult = fromBits(bits(bigResult) ^ sign);
+
+        // -1/(r + u) sans perte : partie haute tronquée à 32 bits puis correction
+        const Vu high = Vu{} + static_cast<uint64_t>(0xFFFFFFFF00000000ULL);
+        Vd th = fromBits(bits(tn) & high);
+        Vd tl = u - (th - r);
+        Vd ah = fromBits(bits(a) & high);
+        Vd e = 1.0 + ah * th;
+        Vd inverse = ah + a * (e + ah * tl);
+
+        // tan(-0) = -0
+        return select(x == 0.0, x, select(big, bigResult, select(odd, inverse, tn)));
+    }
+
+    static auto trigSpecial(Vd x) {
+        // Comparaison fausse pour NaN : !(|x| <= limite) couvre NaN et infinis
+        Vd ax = fromBits(bits(x) & static_cast<uint64_t>(0x7FFFFFFFFFFFFFFFULL));
+        return !(ax <= TRIG_LIMIT);
+    }
+
+    static auto logSpecial(Vd x) {
+        return !((x > 0.0) & (x <= MAX_FINITE));
+    }
+
+    static void sinKernel(const double* x, double* out, size_t n) {
+        apply(x, out, n, sinCore, trigSpecial, static_cast<double (*)(double)>(std::sin));
+    }
+
+    static void cosKernel(const double* x, double* out, size_t n) {
+        apply(x, out, n, cosCore, trigSpecial, static_cast<double (*)(double)>(std::cos));
+    }
+
+    static void tanKernel(const double* x, double* out, size_t n) {
+        apply(x, out, n, tanCore, trigSpecial, static_cast<double (*)(double)>(std::tan));
+    }
+
+    static void expKernel(const double* x, double* out, size_t n) {
+        auto special = [](Vd v) {
+            Vd av = fromBits(bits(v) & static_cast<uint64_t>(0x7FFFFFFFFFFFFFFFULL));
+            return !(av <= EXP_LIMIT);
+        };
+        apply(x, out, n, expCore, special, static_cast<double (*)(double)>(std::exp));
+    }
+
+    static void logKernel(const double* x, double* out, size_t n) {
+        apply(x, out, n, logCore, logSpecial, static_cast<double (*)(double)>(std::log));
+    }
+
+    static void log10Kernel(const double* x, double* out, size_t n) {
+        apply(x, out, n, log10Core, logSpecial, static_cast<double (*)(double)>(std::log10));
+    }
+
+    static void sqrtKernel(const double* x, double* out, size_t n) {
+        // Vectorisé par le compilateur (instructions sqrt IEEE, arrondi correct)
+        for (size_t i = 0; i < n; ++i) {
+            out[i] = std::sqrt(x[i]);
+        }
+    }
+
+    static const VectorMathTable& table() {
+        static const VectorMathTable kernels = {
+            sinKernel, cosKernel, tanKernel, expKernel, logKernel, log10Kernel, sqrtKernel
+        };
+        return kernels;
+    }
+};
+
+} // namespace
+
+} // namespace VectorMathKernels
+
+#endif // defined(__GNUC__)
+
+} // namespace FusioCore
+
+#endif // VECTOR_MATH_KERNELS_HPP
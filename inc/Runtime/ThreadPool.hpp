@@ -0,0 +1,156 @@
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+#include <Eigen/Dense>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace FusioCore {
+
+/**
+ * Pool de threads partagé par les calculs parallèles
+ *
+ * La taille est lue dans la variable d'environnement FUSIO_NUM_THREADS
+ * (par défaut : nombre de cœurs) et peut être modifiée à l'exécution. Elle
+ * fixe aussi le nombre de threads OpenMP utilisés par Eigen (produits et
+ * décompositions), lorsque le projet est compilé avec OpenMP.
+ *
+ * Reproductibilité :
+ * - les réductions (parallelSum) sont découpées en blocs de taille fixe dont
+ *   les sommes partielles sont combinées dans l'ordre : le résultat ne dépend
+ *   pas du nombre de threads ;
+ * - en mode déterministe, Eigen est limité à un thread et les produits
+ *   matriciels sont découpés en panneaux de colonnes de largeur fixe
+ *   (multiply) : tous les résultats sont alors identiques bit à bit quel que
+ *   soit le nombre de threads. Hors de ce mode, le GEMM parallèle d'Eigen
+ *   adapte ses blocs au nombre de threads.
+ */
+class ThreadPool {
+public:
+    using RangeFunction = std::function<void(Eigen::Index begin, Eigen::Index end)>;
+    using PartialFunction = std::function<double(Eigen::Index begin, Eigen::Index end)>;
+    
+    // Nombre d'éléments à partir duquel les noyaux élément par élément sont parallélisés
+    static constexpr Eigen::Index PARALLEL_THRESHOLD = 1 << 15;
+    
+    // Taille des blocs des réductions
+    static constexpr Eigen::Index REDUCTION_BLOCK = 1 << 13;
+    
+    // Largeur des panneaux de colonnes des produits en mode déterministe
+    static constexpr Eigen::Index GEMM_PANEL = 64;
+    
+    // Nombre maximal de threads par cœur accepté par setThreadCount
+    static constexpr size_t MAX_THREADS_PER_CORE = 4;
+    
+    static ThreadPool& getInstance();
+    
+    /**
+     * Retourne le nombre maximal de threads (MAX_THREADS_PER_CORE par cœur)
+     */
+    static size_t getMaxThreadCount();
+    
+    ~ThreadPool();
+    
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    
+    /**
+     * Retourne le nombre de threads (thread appelant compris)
+     */
+    size_t getThreadCount() const;
+    
+    /**
+     * Redimensionne le pool ; en cas d'échec, le pool reste inchangé
+     * @param count Nombre de threads, 0 pour le nombre de cœurs
+     * @throw std::runtime_error si count dépasse getMaxThreadCount()
+     * @throw std::system_error si un thread ne peut pas être créé
+     */
+    void setThreadCount(size_t count);
+    
+    bool isDeterministic() const;
+    void setDeterministic(bool deterministic);
+    
+    /**
+     * Exécute body sur [0, n) découpé en intervalles d'au plus grain éléments
+     * Les appels imbriqués (depuis un thread du pool), ou concurrents d'un
+     * travail en cours, s'exécutent en séquentiel sur le thread appelant.
+     */
+    void parallelFor(Eigen::Index n, Eigen::Index grain, const RangeFunction& body);
+    
+    /**
+     * Somme de partial sur [0, n) par blocs de REDUCTION_BLOCK éléments
+     * @return La somme des résultats partiels, combinés dans l'ordre des blocs
+     */
+    double parallelSum(Eigen::Index n, const PartialFunction& partial);
+    
+    /**
+     * dst = coef * lhs * rhs, ou dst += coef * lhs * rhs si accumulate
+     * En mode déterministe, le produit est calculé par panneaux de colonnes
+     * de largeur fixe répartis sur le pool ; sinon par Eigen.
+     */
+    template <typename Dst, typename Lhs, typename Rhs>
+    void multiply(Dst&& dst, const Lhs& lhs, const Rhs& rhs, double coef, bool accumulate) {
+        auto panel = [&](Eigen::Index begin, Eigen::Index end) {
+            auto out = dst.middleCols(begin, end - begin);
+            if (accumulate) {
+                out.noalias() += (coef * lhs) * rhs.middleCols(begin, end - begin);
+            } else {
+                out.noalias() = (coef * lhs) * rhs.middleCols(begin, end - begin);
+            }
+        };
+        
+        if (isDeterministic() && dst.cols() > GEMM_PANEL) {
+            parallelFor(dst.cols(), GEMM_PANEL, panel);
+        } else {
+            panel(0, dst.cols());
+        }
+    }
+    
+private:
+    ThreadPool();
+    
+    // Travail en cours : intervalles distribués dynamiquement
+    struct Job {
+        const RangeFunction* body = nullptr;
+        Eigen::Index size = 0;
+        Eigen::Index grain = 0;
+        std::atomic<Eigen::Index> next{0};
+        std::atomic<Eigen::Index> remaining{0};
+        std::exception_ptr error;
+    };
+    
+    // Threads démarrés ensemble, arrêtés par leur propre indicateur
+    struct Workers {
+        std::vector<std::thread> threads;
+        bool stopping = false;  // Protégé par mutex_
+    };
+    
+    // Démarre count threads ; ceux déjà démarrés sont arrêtés si l'un échoue
+    std::unique_ptr<Workers> startWorkers(size_t count);
+    void stopWorkers(Workers& workers);
+    void workerLoop(const Workers* workers);
+    void runChunks(Job& job);
+    void configureEigen() const;
+    
+    std::unique_ptr<Workers> workers_ = std::make_unique<Workers>();
+    std::mutex mutex_;
+    std::condition_variable wakeCondition_;
+    std::condition_variable doneCondition_;
+    std::mutex submitMutex_;  // Un seul travail distribué à la fois
+    Job* job_ = nullptr;
+    size_t generation_ = 0;
+    size_t activeWorkers_ = 0;
+    std::atomic<size_t> threadCount_{1};
+    std::atomic<bool> deterministic_{false};
+};
+
+} // namespace FusioCore
+
+#endif // THREAD_POOL_HPP
@@ -0,0 +1,92 @@
+#ifndef EVALUATION_SERVER_HPP
+#define EVALUATION_SERVER_HPP
+
+#include "Expression/ProgramCache.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace FusioCore {
+
+/**
+ * Adresse et réglages du serveur
+ */
+struct ServerOptions {
+    // Adresse d'écoute : "unix:/chemin/socket", "tcp:hôte:port" ou "port" (127.0.0.1)
+    std::string address;
+    
+    // Nombre de boucles d'événements (une par thread), 0 pour le nombre de cœurs
+    size_t threads = 0;
+    
+    // Taille maximale d'une requête ; au-delà, la connexion est fermée
+    size_t maxRequestSize = size_t(64) << 20;
+    
+    // Répertoire des fichiers de save, load et readcsv ; vide : instructions refusées
+    std::string fileRoot;
+};
+
+/**
+ * Serveur d'évaluation local (protocole ServerProtocol)
+ *
+ * Chaque connexion a sa propre session (FusioInterpreter) ; les programmes
+ * compilés sont partagés par toutes les sessions. Les connexions sont servies
+ * par plusieurs boucles d'événements epoll, une par thread : une connexion
+ * reste sur la boucle qui l'a acceptée, et ses requêtes sont exécutées dans
+ * l'ordre de réception. Les requêtes déjà reçues sont traitées sans attendre
+ * l'envoi des réponses précédentes (pipelining), tant que les réponses en
+ * attente ne dépassent pas la limite d'écriture.
+ *
+ * Les clients n'accèdent aux fichiers du serveur (save, load, readcsv) que
+ * sous ServerOptions::fileRoot. Une socket Unix n'est accessible qu'à son
+ * propriétaire (0600).
+ *
+ * Disponible sous Linux uniquement (epoll).
+ */
+class EvaluationServer {
+public:
+    // Réponses en attente d'envoi au-delà desquelles une connexion n'est plus lue
+    static constexpr size_t MAX_PENDING_OUTPUT = size_t(64) << 20;
+    
+    /**
+     * Ouvre la socket d'écoute
+     * @param options L'adresse et les réglages
+     * @throw std::runtime_error si l'adresse est invalide ou déjà utilisée,
+     *        ou si la plateforme ne dispose pas d'epoll
+     */
+    explicit EvaluationServer(ServerOptions options);
+    ~EvaluationServer();
+    
+    EvaluationServer(const EvaluationServer&) = delete;
+    EvaluationServer& operator=(const EvaluationServer&) = delete;
+    
+    /**
+     * Sert les connexions jusqu'à l'appel de stop()
+     * @throw std::runtime_error si une boucle d'événements ne peut pas être créée
+     */
+    void run();
+    
+    // Interrompt run() ; peut être appelé depuis un autre thread ou un gestionnaire de signal
+    void stop();
+    
+    // Adresse effective (port choisi par le système si 0 était demandé)
+    const std::string& getAddress() const;
+
+private:
+    struct Loop;
+    
+    ServerOptions options_;
+    std::string address_;
+    std::string unixPath_;  // Socket Unix à supprimer à la fermeture
+    int listener_ = -1;
+    int stopEvent_ = -1;    // eventfd réveillant les boucles
+    std::atomic<bool> stopping_{false};
+    
+    std::shared_ptr<ProgramCache> programs_;
+};
+
+} // namespace FusioCore
+
+#endif // EVALUATION_SERVER_HPP
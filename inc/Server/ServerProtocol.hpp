@@ -0,0 +1,85 @@
+#ifndef SERVER_PROTOCOL_HPP
+#define SERVER_PROTOCOL_HPP
+
+#include "Value/Variant.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace FusioCore {
+
+/**
+ * Protocole requête/réponse du mode serveur
+ *
+ * Chaque message est précédé de sa longueur (uint32, sans compter ces 4
+ * octets). Tous les entiers sont petit-boutistes.
+ *
+ * Requête : instructions en UTF-8 séparées par '\n' (les lignes vides sont
+ * ignorées), exécutées dans l'ordre par la session de la connexion.
+ *
+ * Réponse : uint32 nombre de résultats, puis pour chaque instruction un
+ * octet de nature suivi de son contenu :
+ *   0 erreur          uint32 longueur, message UTF-8
+ *   1 scalaire        float64
+ *   2 vecteur         uint32 type des éléments, uint64 taille, éléments
+ *   3 matrice         uint32 type des éléments, uint64 lignes, uint64 colonnes,
+ *                     éléments en ordre colonne
+ *   4 matrice creuse  uint64 lignes, uint64 colonnes, uint64 nombre n
+ *                     d'éléments non nuls, puis n uint64 lignes, n uint64
+ *                     colonnes et n float64 valeurs (indices à partir de 0)
+ * Les types des éléments sont ceux des fichiers .fmat (1 : float64,
+ * 2 : float32, 3 : int32, 4 : int64) : les éléments sont copiés tels quels.
+ *
+ * Plusieurs requêtes peuvent être envoyées sans attendre les réponses
+ * (pipelining) ; les réponses d'une connexion suivent l'ordre des requêtes.
+ */
+class ServerProtocol {
+public:
+    // Taille du préfixe de longueur
+    static constexpr size_t LENGTH_SIZE = sizeof(uint32_t);
+    
+    // Nature d'un résultat
+    static constexpr uint8_t RESULT_ERROR = 0;
+    static constexpr uint8_t RESULT_SCALAR = 1;
+    static constexpr uint8_t RESULT_VECTOR = 2;
+    static constexpr uint8_t RESULT_MATRIX = 3;
+    static constexpr uint8_t RESULT_SPARSE = 4;
+    
+    /**
+     * Longueur du message en tête d'un tampon
+     * @param data Le début du tampon, au moins LENGTH_SIZE octets
+     */
+    static uint32_t readLength(const char* data);
+    
+    /**
+     * Découpe une requête en instructions (sans copie)
+     * @param payload Le contenu de la requête, sans le préfixe de longueur
+     * @return Les instructions non vides, sans espaces en tête et en fin
+     */
+    static std::vector<std::string_view> splitStatements(std::string_view payload);
+    
+    /**
+     * Commence une réponse à la fin de out (préfixe de longueur réservé)
+     * @return La position de la réponse, à passer à endResponse
+     */
+    static size_t beginResponse(std::string& out, uint32_t count);
+    
+    /**
+     * Termine la réponse commencée en start : écrit sa longueur
+     * @throw std::runtime_error si la réponse dépasse 4 Go
+     */
+    static void endResponse(std::string& out, size_t start);
+    
+    /**
+     * Ajoute un résultat à la réponse
+     * @throw std::runtime_error si la valeur est vide
+     */
+    static void appendValue(std::string& out, const Value& value);
+    static void appendError(std::string& out, std::string_view message);
+};
+
+} // namespace FusioCore
+
+#endif // SERVER_PROTOCOL_HPP
@@ -0,0 +1,47 @@
+#ifndef BATCH_SHELL_HPP
+#define BATCH_SHELL_HPP
+
+#include "Shell/IShell.hpp"
+#include <iostream>
+
+namespace FusioCore {
+
+/**
+ * Shell des exécutions non interactives (script ou entrée redirigée)
+ *
+ * Pas de couleurs ni d'invite, et aucune vidange par ligne : la sortie est
+ * mise en mémoire tampon et vidée par flush() ou à la destruction. Les
+ * erreurs et avertissements sont écrits sur la sortie d'erreur ; la sortie
+ * standard n'est vidée avant eux que si les deux flux aboutissent au même
+ * endroit.
+ */
+class BatchShell : public IShell {
+public:
+    static BatchShell& getInstance();
+    
+    BatchShell();
+    ~BatchShell() override;
+    
+    void print(const std::string& message, bool newLine = true) const override;
+    void print(const std::string& message, ShellType type, bool newLine = true) const override;
+    void printBold(const std::string& message, bool newLine = true) const override;
+    void printBold(const std::string& message, ShellType type, bool newLine = true) const override;
+    void printValue(const Value& value, ShellType type, bool newLine = true) const override;
+    void printProjectInfo() const override;
+    
+    // Lit la ligne suivante de l'entrée standard (sans invite)
+    std::string waitInput(const std::string& message = "") override;
+    
+    // Vide la sortie mise en tampon
+    void flush() const;
+    
+private:
+    std::ostream& streamFor(ShellType type) const;
+    
+    // Sortie standard et sortie d'erreur désignent le même fichier ou terminal
+    bool sharedOutput_;
+};
+
+} // namespace FusioCore
+
+#endif // BATCH_SHELL_HPP
@@ -5,6 +5,8 @@
 #include <iostream>
 
 namespace FusioCore {
+class Value;
+
 enum class ShellType {
     DEFAULT,
     INFO,
@@ -35,6 +37,9 @@ public:
     virtual void printBold(const std::string& message, bool newLine = true) const = 0;
     virtual void printBold(const std::string& message, ShellType type, bool newLine = true) const = 0;
     
+    // Afficher une valeur, écrite directement dans la sortie (options de ValueFormatter)
+    virtual void printValue(const Value& value, ShellType type, bool newLine = true) const = 0;
+    
     // Afficher les informations du projet
     virtual void printProjectInfo() const = 0;
     
@@ -19,6 +19,7 @@ public:
     void print(const std::string& message, ShellType type, bool newLine = true) const override;
     void printBold(const std::string& message, bool newLine = true) const override;
     void printBold(const std::string& message, ShellType type, bool newLine = true) const override;
+    void printValue(const Value& value, ShellType type, bool newLine = true) const override;
     void printProjectInfo() const override;
 
     // Implémentation de la méthode d'entrée
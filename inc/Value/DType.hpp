@@ -0,0 +1,141 @@
+#ifndef DTYPE_HPP
+#define DTYPE_HPP
+
+#include <Eigen/Dense>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace FusioCore {
+
+/**
+ * Type des éléments d'un vecteur ou d'une matrice
+ */
+enum class DType {
+    F32,  // float (single)
+    F64,  // double, type par défaut
+    I32,  // int32_t
+    I64   // int64_t
+};
+
+// Tableaux Eigen d'éléments de type T
+template <typename T>
+using MatrixOf = Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic>;
+template <typename T>
+using VectorOf = Eigen::Matrix<T, Eigen::Dynamic, 1>;
+
+// Type des éléments -> DType
+template <typename T>
+struct DTypeOf;
+template <>
+struct DTypeOf<float> { static constexpr DType value = DType::F32; };
+template <>
+struct DTypeOf<double> { static constexpr DType value = DType::F64; };
+template <>
+struct DTypeOf<int32_t> { static constexpr DType value = DType::I32; };
+template <>
+struct DTypeOf<int64_t> { static constexpr DType value = DType::I64; };
+
+// Type des éléments transmis par dispatch
+template <typename T>
+struct ElementTag {
+    using type = T;
+};
+
+// Type de calcul : les entiers sont calculés en double, puis arrondis et saturés par narrow
+template <typename T>
+using ComputeType = std::conditional_t<std::is_integral_v<T>, double, T>;
+
+/**
+ * Appelle f(ElementTag<T>{}) avec le type T des éléments de dtype : un noyau
+ * écrit une fois comme template est instancié pour chaque type
+ * @param dtype Le type des éléments
+ * @param f L'opération, dont le type de retour ne dépend pas de T
+ */
+template <typename F>
+decltype(auto) dispatch(DType dtype, F&& f) {
+    switch (dtype) {
+        case DType::F32: return f(ElementTag<float>{});
+        case DType::I32: return f(ElementTag<int32_t>{});
+        case DType::I64: return f(ElementTag<int64_t>{});
+        case DType::F64: break;
+    }
+    return f(ElementTag<double>{});
+}
+
+/**
+ * Type du résultat d'une opération entre deux tableaux : le type commun s'ils
+ * sont identiques, l'entier le plus large entre deux entiers, F64 sinon (un
+ * float ne représente pas tous les int32). Un scalaire, toujours en double,
+ * ne change pas le type d'un tableau.
+ */
+DType promote(DType a, DType b);
+
+// Type d'un résultat flottant (sin, inv, A \ b) : F32 reste F32, un entier donne F64
+DType floating(DType dtype);
+
+bool isInteger(DType dtype);
+
+// Nom du type, qui est aussi celui de la fonction de conversion (single, double, int32, int64)
+const char* dtypeName(DType dtype);
+
+/**
+ * Convertit un double en T : arrondi au plus proche et saturation pour un
+ * entier (NaN donne 0), float le plus proche sinon
+ * @param value La valeur à convertir
+ * @return La valeur dans le type T
+ */
+template <typename T>
+T narrow(double value) {
+    if constexpr (std::is_integral_v<T>) {
+        if (std::isnan(value)) {
+            return 0;
+        }
+        const double rounded = std::round(value);
+        if (rounded >= static_cast<double>(std::numeric_limits<T>::max())) {
+            return std::numeric_limits<T>::max();
+        }
+        if (rounded <= static_cast<double>(std::numeric_limits<T>::min())) {
+            return std::numeric_limits<T>::min();
+        }
+        return static_cast<T>(rounded);
+    } else {
+        return static_cast<T>(value);
+    }
+}
+
+/**
+ * Tableau d'éléments de type T calculé par une expression en ComputeType<T> :
+ * converti par narrow pour un entier, évalué directement sinon
+ */
+template <typename T, typename Derived>
+Eigen::Matrix<T, Derived::RowsAtCompileTime, Derived::ColsAtCompileTime>
+narrowed(const Eigen::MatrixBase<Derived>& elements) {
+    if constexpr (std::is_integral_v<T>) {
+        return elements.unaryExpr([](ComputeType<T> value) { return narrow<T>(value); });
+    } else {
+        return elements.template cast<T>();
+    }
+}
+
+/**
+ * Variante de narrowed pour une expression dont les valeurs sont déjà entières
+ * (somme ou différence d'entiers) : sans arrondi, la saturation en int32 est
+ * vectorisée (les bornes de int32 sont exactes en double)
+ */
+template <typename T, typename Derived>
+Eigen::Matrix<T, Derived::RowsAtCompileTime, Derived::ColsAtCompileTime>
+saturated(const Eigen::MatrixBase<Derived>& elements) {
+    if constexpr (std::is_same_v<T, int32_t>) {
+        return elements.cwiseMax(static_cast<double>(std::numeric_limits<T>::min()))
+            .cwiseMin(static_cast<double>(std::numeric_limits<T>::max()))
+            .template cast<T>();
+    } else {
+        return narrowed<T>(elements);
+    }
+}
+
+} // namespace FusioCore
+
+#endif // DTYPE_HPP
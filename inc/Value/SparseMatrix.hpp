@@ -0,0 +1,125 @@
+#ifndef SPARSE_MATRIX_HPP
+#define SPARSE_MATRIX_HPP
+
+#include "Value/Value.hpp"
+#include <Eigen/Sparse>
+#include <memory>
+#include <vector>
+
+namespace FusioCore {
+
+/**
+ * Solveurs itératifs des systèmes creux
+ */
+enum class IterativeMethod {
+    ConjugateGradient,  // Matrice symétrique définie positive
+    BiCgStab            // Matrice carrée quelconque
+};
+
+/**
+ * Matrice creuse (stockage compressé par colonnes, Eigen::SparseMatrix)
+ *
+ * Seuls les éléments non nuls sont stockés : une matrice de graphe ou
+ * d'éléments finis de 10⁶ x 10⁶ tient en quelques dizaines de Mo. Comme
+ * Matrix, les copies partagent leurs éléments jusqu'à la première écriture
+ * et les décompositions (LDLᵀ, LU) sont conservées avec la valeur.
+ */
+class SparseMatrix final {
+public:
+    using Storage = Eigen::SparseMatrix<double>;
+    using Triplet = Eigen::Triplet<double>;
+    
+    // Les données sont prises par valeur : un temporaire (std::move) est déplacé sans copie
+    explicit SparseMatrix(Storage data = Storage());
+    
+    /**
+     * Construit une matrice à partir de triplets (ligne, colonne, valeur)
+     * @param rows Le nombre de lignes
+     * @param cols Le nombre de colonnes
+     * @param triplets Les éléments, indices à partir de 0 ; les doublons sont additionnés
+     * @throw std::runtime_error si un indice est hors des dimensions
+     */
+    SparseMatrix(Eigen::Index rows, Eigen::Index cols, const std::vector<Triplet>& triplets);
+    
+    /**
+     * Convertit une matrice dense (les zéros ne sont pas stockés)
+     * @param dense La matrice dense
+     */
+    explicit SparseMatrix(const Eigen::Ref<const Eigen::MatrixXd>& dense);
+    
+    const Storage& getData() const;
+    // Écriture : des éléments partagés avec une copie sont d'abord dupliqués
+    Storage& getData();
+    void setData(Storage data);
+    size_t rows() const;
+    size_t cols() const;
+    size_t nonZeros() const;
+    
+    std::string toString() const;
+    
+    // Opérations, creuses tant que le résultat l'est
+    SparseMatrix operator+(const SparseMatrix& other) const;
+    SparseMatrix operator-(const SparseMatrix& other) const;
+    SparseMatrix operator*(const SparseMatrix& other) const;
+    SparseMatrix operator*(const Scalar& scalar) const;
+    Matrix operator*(const Matrix& matrix) const;
+    Vector operator*(const Vector& vector) const;
+    SparseMatrix transpose() const;
+    Matrix toDense() const;
+    
+    // Symétrie exacte, évaluée une fois
+    bool isSymmetric() const;
+    
+    // Décompositions directes, calculées à la première demande puis conservées
+    const Eigen::SimplicialLDLT<Storage>& ldlt() const;
+    const Eigen::SparseLU<Storage>& lu() const;
+    
+    // Déterminant par la décomposition LU, nul si la matrice est singulière
+    double determinant() const;
+    
+    /**
+     * Résout A * X = rhs par décomposition directe : LDLᵀ si A est
+     * symétrique définie (positive ou négative), LU sinon
+     * @param rhs Le ou les seconds membres
+     * @return La solution
+     * @throw std::runtime_error si A n'est pas carrée ou pas inversible
+     */
+    Eigen::MatrixXd solve(const Eigen::Ref<const Eigen::MatrixXd>& rhs) const;
+    
+    /**
+     * Résout A * x = rhs par une méthode itérative (préconditionneur diagonal)
+     * @param method Le solveur
+     * @param rhs Le second membre
+     * @param tolerance L'erreur relative visée
+     * @param maxIterations Le nombre maximal d'itérations (0 : celui d'Eigen, 2n)
+     * @return La solution
+     * @throw std::runtime_error si A n'est pas carrée, si tolerance n'est pas
+     *        un réel fini strictement positif, ou si le solveur ne converge pas
+     */
+    Eigen::VectorXd solveIterative(IterativeMethod method, const Eigen::Ref<const Eigen::VectorXd>& rhs,
+                                   double tolerance, Eigen::Index maxIterations) const;
+    
+    /**
+     * Nombre maximal d'itérations donné par un argument maxit
+     * @throw std::runtime_error si value n'est pas un entier fini strictement positif (au plus INT_MAX)
+     */
+    static Eigen::Index iterationLimit(double value);
+    
+private:
+    struct Factorizations {
+        std::shared_ptr<const Eigen::SimplicialLDLT<Storage>> ldlt;
+        std::shared_ptr<const Eigen::SparseLU<Storage>> lu;
+        int symmetric = -1;  // -1 : non évaluée
+    };
+    
+    void requireSquare(const char* operation) const;
+    
+    // Éléments partagés entre copies (copie à l'écriture)
+    std::shared_ptr<Storage> data_;
+    
+    mutable Factorizations factorizations_;
+};
+
+} // namespace FusioCore
+
+#endif // SPARSE_MATRIX_HPP
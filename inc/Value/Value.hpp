@@ -1,33 +1,29 @@
 #pragma once
 
+#include "Value/DType.hpp"
 #include <memory>
 #include <string>
 #include <Eigen/Dense>
 
 namespace FusioCore {
 
-// Interface de base pour toutes les valeurs
-class IValue {
-public:
-    virtual ~IValue() = default;
-    virtual std::string toString() const = 0;
-    virtual bool isMatrix() const = 0;
-    virtual bool isScalar() const = 0;
-    virtual bool isVector() const = 0;
+// Type d'une valeur (alternative de Value, type d'un nœud après typage)
+enum class ValueKind {
+    Scalar,
+    Vector,
+    Matrix,
+    Sparse    // SparseMatrix
 };
 
 // Classe pour les valeurs scalaires
-class Scalar : public IValue {
+class Scalar final {
 public:
     explicit Scalar(double value = 0.0);
     
     double getValue() const;
     void setValue(double value);
     
-    std::string toString() const override;
-    bool isMatrix() const override { return false; }
-    bool isScalar() const override { return true; }
-    bool isVector() const override { return false; }
+    std::string toString() const;
     
     // Opérateurs arithmétiques
     Scalar operator+(const Scalar& other) const;
@@ -40,66 +36,255 @@ private:
 };
 
 // Classe pour les vecteurs
-class Vector : public IValue {
+// Les copies partagent leurs éléments jusqu'à la première écriture. Les
+// éléments sont des double par défaut, ou des float, int32 ou int64 (dtype)
+class Vector final {
 public:
-    explicit Vector(const Eigen::VectorXd& data = Eigen::VectorXd::Zero(0));
+    // Les données sont prises par valeur : un temporaire (std::move) est déplacé sans copie
+    explicit Vector(Eigen::VectorXd data = Eigen::VectorXd());
     Vector(size_t size, double defaultValue = 0.0);
     
-    const Eigen::VectorXd& getData() const;
+    // Vecteur d'éléments float, int32_t ou int64_t
+    template <typename T>
+    explicit Vector(VectorOf<T> data);
+    
+    // Éléments externes (double, float, int32_t ou int64_t), lus sans copie et
+    // jamais modifiés : owner les garde valides, la première écriture les copie
+    template <typename T>
+    Vector(const T* data, Eigen::Index size, std::shared_ptr<const void> owner);
+    
+    // Lecture en double, sans copie pour des éléments double (propres ou
+    // externes) ; les éléments d'un autre type sont convertis à la première
+    // lecture, et la conversion est conservée avec la valeur
+    Eigen::Ref<const Eigen::VectorXd> getData() const;
+    // Écriture : des éléments partagés avec une copie sont d'abord dupliqués,
+    // ceux d'un autre type convertis en double (dtype() devient F64)
     Eigen::VectorXd& getData();
-    void setData(const Eigen::VectorXd& data);
+    void setData(Eigen::VectorXd data);
     size_t size() const;
     
-    std::string toString() const override;
-    bool isMatrix() const override { return false; }
-    bool isScalar() const override { return false; }
-    bool isVector() const override { return true; }
+    DType dtype() const;
     
-    // Opérateurs arithmétiques
+    // Éléments de type T, sans copie ni conversion
+    // @throw std::runtime_error si T ne correspond pas à dtype()
+    template <typename T>
+    Eigen::Map<const VectorOf<T>> getTypedData() const;
+    
+    // Conversion (arrondi et saturation vers un entier) ; une copie partagée si le type est déjà dtype
+    Vector astype(DType dtype) const;
+    
+    std::string toString() const;
+    
+    // Opérateurs arithmétiques, calculés dans le type promu (promote)
     Vector operator+(const Vector& other) const;
     Vector operator-(const Vector& other) const;
     Scalar operator*(const Vector& other) const; // Produit scalaire
     Vector operator*(const Scalar& scalar) const;
     
 private:
-    Eigen::VectorXd data_;
+    friend class Matrix;
+    
+    // Éléments convertis en T, sans copie s'ils sont déjà de ce type
+    template <typename T>
+    Eigen::Ref<const VectorOf<T>> elementsAs() const;
+    
+    // Éléments double (data_ ou external_), en lecture
+    Eigen::Map<const Eigen::VectorXd> view() const;
+    
+    // Éléments partagés entre copies (copie à l'écriture), nul si typed_ ou external_ est renseigné
+    std::shared_ptr<Eigen::VectorXd> data_;
+    
+    // Éléments double externes (projection d'un fichier), en lecture seule
+    struct External {
+        const double* data = nullptr;
+        Eigen::Index size = 0;
+        std::shared_ptr<const void> owner;
+    };
+    External external_;
+    
+    // Éléments d'un type autre que double, en lecture seule
+    struct Typed {
+        DType dtype = DType::F64;
+        const void* data = nullptr;
+        Eigen::Index size = 0;
+        std::shared_ptr<const void> owner;
+        mutable std::shared_ptr<const Eigen::VectorXd> widened;  // Conversion en double conservée
+    };
+    Typed typed_;
 };
 
 // Classe pour les matrices
-class Matrix : public IValue {
+// Les copies partagent leurs éléments jusqu'à la première écriture ; une vue
+// (transposée, sous-matrice) référence les éléments de la matrice d'origine
+class Matrix final {
 public:
-    explicit Matrix(const Eigen::MatrixXd& data = Eigen::MatrixXd::Zero(0, 0));
+    // Indices sélectionnés : first, first + step, ... (size indices, à partir de 0)
+    struct Range {
+        Eigen::Index first = 0;
+        Eigen::Index size = 0;
+        Eigen::Index step = 1;
+    };
+    
+    // Les données sont prises par valeur : un temporaire (std::move) est déplacé sans copie
+    explicit Matrix(Eigen::MatrixXd data = Eigen::MatrixXd());
     Matrix(size_t rows, size_t cols, double defaultValue = 0.0);
     
-    const Eigen::MatrixXd& getData() const;
+    // Matrice d'éléments float, int32_t ou int64_t
+    template <typename T>
+    explicit Matrix(MatrixOf<T> data);
+    
+    // Matrice référençant un stockage externe en lecture seule (fichier projeté
+    // en mémoire) : data, en ordre colonne, reste valide tant que owner existe
+    Matrix(const double* data, Eigen::Index rows, Eigen::Index cols, std::shared_ptr<const void> owner);
+    // Stockage externe à pas quelconques, en éléments (strictement positifs) :
+    // l'élément (i, j) est data[i * innerStride + j * outerStride]
+    Matrix(const double* data, Eigen::Index rows, Eigen::Index cols, Eigen::Index outerStride,
+           Eigen::Index innerStride, std::shared_ptr<const void> owner);
+    template <typename T>
+    Matrix(const T* data, Eigen::Index rows, Eigen::Index cols, std::shared_ptr<const void> owner);
+    
+    // Lecture sans copie, que le stockage soit propre ou externe ; une vue
+    // dont les lignes ne sont pas consécutives (transposée, pas > 1) est copiée.
+    // Des éléments d'un autre type que double sont convertis à la première
+    // lecture, et la conversion est conservée avec la valeur.
+    Eigen::Ref<const Eigen::MatrixXd> getData() const;
+    // Écriture : un stockage externe ou partagé avec une copie est d'abord
+    // dupliqué, des éléments d'un autre type convertis en double (dtype() devient F64)
     Eigen::MatrixXd& getData();
-    void setData(const Eigen::MatrixXd& data);
+    void setData(Eigen::MatrixXd data);
     size_t rows() const;
     size_t cols() const;
+    bool isExternal() const;
+    // Éléments consécutifs en ordre colonne (getData().data() les parcourt tous)
+    bool isContiguous() const;
     
-    std::string toString() const override;
-    bool isMatrix() const override { return true; }
-    bool isScalar() const override { return false; }
-    bool isVector() const override { return false; }
+    // Copie une vue non contiguë dans un stockage propre, sans changer la valeur
+    void materialize();
     
-    // Opérateurs arithmétiques
+    DType dtype() const;
+    
+    // Éléments de type T, sans copie sauf vue non contiguë
+    // @throw std::runtime_error si T ne correspond pas à dtype()
+    template <typename T>
+    Eigen::Ref<const MatrixOf<T>> getTypedData() const;
+    
+    // Conversion (arrondi et saturation vers un entier) ; une copie partagée si le type est déjà dtype
+    Matrix astype(DType dtype) const;
+    
+    std::string toString() const;
+    
+    // Opérateurs arithmétiques, calculés dans le type promu (promote) ; un
+    // scalaire ne change pas le type, les entiers sont calculés en double puis arrondis
     Matrix operator+(const Matrix& other) const;
     Matrix operator-(const Matrix& other) const;
     Matrix operator*(const Matrix& other) const;
     Matrix operator*(const Scalar& scalar) const;
     Vector operator*(const Vector& vector) const;
     
-    // Opérations matricielles
+    // Vues sans copie : les éléments sont partagés avec cette matrice et
+    // dupliqués à la première écriture de l'une ou de l'autre (copies pour
+    // des éléments d'un autre type que double)
     Matrix transpose() const;
+    Matrix slice(const Range& rows, const Range& cols) const;
+    Matrix block(Eigen::Index row, Eigen::Index col, Eigen::Index rows, Eigen::Index cols) const;
+    
+    // Opérations matricielles, en double
     Scalar determinant() const;
     Matrix inverse() const;
     
-    // Accès aux éléments
+    // Décompositions, calculées à la première demande puis conservées avec
+    // la valeur (et partagées par ses copies). Tout accès en écriture aux
+    // données (getData(), setData(), operator()) les invalide.
+    const Eigen::PartialPivLU<Eigen::MatrixXd>& lu() const;
+    const Eigen::LLT<Eigen::MatrixXd>& cholesky() const;  // @throw std::runtime_error si non définie positive
+    const Eigen::ColPivHouseholderQR<Eigen::MatrixXd>& qr() const;
+    
+    // Résout A * x = rhs : LU si A est carrée, moindres carrés (QR) sinon
+    Matrix solve(const Matrix& rhs) const;
+    Vector solve(const Vector& rhs) const;
+    
+    // Inversibilité : aucun pivot exactement nul dans la décomposition LU.
+    // Évaluée une fois avec la décomposition LU en cache.
+    bool isInvertible() const;
+    static bool isInvertible(const Eigen::PartialPivLU<Eigen::MatrixXd>& lu);
+    
+    /**
+     * Vérifie qu'une matrice carrée peut être inversée ou résolue
+     * Un pivot nul est une erreur ; un conditionnement au-delà de la précision
+     * machine (rcond <= epsilon) est seulement signalé par un avertissement
+     * (voir Warnings), le résultat pouvant alors être imprécis.
+     * @throw std::runtime_error si la matrice n'est pas inversible
+     */
+    void requireInvertible() const;
+    static void requireInvertible(const Eigen::PartialPivLU<Eigen::MatrixXd>& lu);
+    
+    // Accès aux éléments (lecture convertie en double pour les éléments d'un autre type)
     double& operator()(size_t i, size_t j);
-    const double& operator()(size_t i, size_t j) const;
+    double operator()(size_t i, size_t j) const;
     
 private:
-    Eigen::MatrixXd data_;
+    struct Factorizations {
+        std::shared_ptr<const Eigen::PartialPivLU<Eigen::MatrixXd>> lu;
+        bool invertible = false;  // Calculés avec lu
+        double rcond = 0.0;
+        std::shared_ptr<const Eigen::LLT<Eigen::MatrixXd>> cholesky;
+        std::shared_ptr<const Eigen::ColPivHouseholderQR<Eigen::MatrixXd>> qr;
+    };
+    
+    // Résout avec la décomposition adaptée à la forme de la matrice
+    template <typename Rhs>
+    Eigen::MatrixXd solveWith(const Rhs& rhs) const;
+    
+    // Éléments convertis en T, sans copie s'ils sont déjà de ce type
+    template <typename T>
+    Eigen::Ref<const MatrixOf<T>> elementsAs() const;
+    
+    // Éléments convertis en double, conversion conservée (typed_.widened)
+    const Eigen::MatrixXd& widened() const;
+    
+    // Opération élément par élément (+, -) dans le type promu des deux matrices
+    template <typename Operation>
+    Matrix combine(const Matrix& other, Operation operation) const;
+    
+    void invalidateFactorizations();
+    
+    using StridedMap = Eigen::Map<const Eigen::MatrixXd, 0, Eigen::Stride<Eigen::Dynamic, Eigen::Dynamic>>;
+    
+    // Vue sur les éléments (stockage propre ou externe)
+    StridedMap view() const;
+    
+    // Rend les éléments propres à cette matrice avant une écriture
+    void detach();
+    
+    // Éléments partagés entre copies (copie à l'écriture), nul si externe
+    std::shared_ptr<Eigen::MatrixXd> data_;
+    
+    // Stockage externe (fichier projeté, éléments d'une autre matrice),
+    // nul si les éléments sont dans data_
+    struct External {
+        std::shared_ptr<const void> owner;
+        const double* data = nullptr;
+        Eigen::Index rows = 0;
+        Eigen::Index cols = 0;
+        Eigen::Index outerStride = 0;  // Écart entre deux colonnes
+        Eigen::Index innerStride = 1;  // Écart entre deux lignes
+    };
+    External external_;
+    
+    // Éléments d'un type autre que double (contigus, en ordre colonne, en
+    // lecture seule) : data_ et external_ sont alors vides
+    struct Typed {
+        DType dtype = DType::F64;
+        const void* data = nullptr;
+        Eigen::Index rows = 0;
+        Eigen::Index cols = 0;
+        std::shared_ptr<const void> owner;
+        bool external = false;  // Stockage externe (fichier projeté)
+        mutable std::shared_ptr<const Eigen::MatrixXd> widened;  // Conversion en double conservée
+    };
+    Typed typed_;
+    
+    mutable Factorizations factorizations_;
 };
 
 } // namespace FusioCore 
\ No newline at end of file
@@ -0,0 +1,85 @@
+#ifndef VALUE_FORMATTER_HPP
+#define VALUE_FORMATTER_HPP
+
+#include "Value/Value.hpp"
+#include <Eigen/Dense>
+#include <ostream>
+#include <string>
+
+namespace FusioCore {
+
+class Value;
+
+/**
+ * Écriture des nombres
+ */
+enum class NumberFormat {
+    Fixed,     // Nombre fixe de décimales (1.500000)
+    Shortest   // Plus courte écriture relue à l'identique (1.5, 1e-20)
+};
+
+/**
+ * Options d'affichage des valeurs
+ */
+struct FormatOptions {
+    NumberFormat format = NumberFormat::Fixed;
+    int precision = 6;              // Décimales du format fixe
+    bool full = false;              // Affiche tous les éléments, quelle que soit la taille
+    Eigen::Index threshold = 1000;  // Nombre d'éléments au-delà duquel la valeur est résumée
+    Eigen::Index edgeItems = 3;     // Lignes/colonnes conservées de chaque côté d'un résumé
+};
+
+/**
+ * Formatage des valeurs pour l'affichage
+ *
+ * Les nombres sont écrits par std::to_chars dans un tampon local, vidé par
+ * blocs dans le flux de sortie : une grande matrice n'est jamais
+ * matérialisée en une seule chaîne. Au-delà de threshold éléments, seules
+ * les edgeItems premières et dernières lignes (et colonnes) sont affichées,
+ * suivies des dimensions, sauf si l'affichage complet est demandé.
+ *
+ * Les options sont partagées par toutes les valeurs (toString) et réglées
+ * depuis le shell.
+ */
+class ValueFormatter {
+public:
+    // Précision maximale du format fixe (au-delà, les chiffres d'un double ne sont plus significatifs)
+    static constexpr int MAX_PRECISION = 17;
+    
+    static ValueFormatter& getInstance();
+    
+    ValueFormatter(const ValueFormatter&) = delete;
+    ValueFormatter& operator=(const ValueFormatter&) = delete;
+    
+    const FormatOptions& getOptions() const;
+    
+    /**
+     * Remplace les options d'affichage
+     * @param options Les nouvelles options
+     * @throw std::runtime_error si la précision ou les seuils sont invalides
+     */
+    void setOptions(const FormatOptions& options);
+    
+    /**
+     * Écrit une valeur dans un flux
+     * @param out Le flux de sortie
+     * @param value La valeur à écrire
+     */
+    void write(std::ostream& out, const Value& value) const;
+    
+    /**
+     * Formate une valeur en chaîne
+     * @param value La valeur à formater
+     * @return Le texte affiché par write
+     */
+    std::string toString(const Value& value) const;
+
+private:
+    ValueFormatter() = default;
+    
+    FormatOptions options_;
+};
+
+} // namespace FusioCore
+
+#endif // VALUE_FORMATTER_HPP
@@ -0,0 +1,139 @@
+#ifndef VARIANT_HPP
+#define VARIANT_HPP
+
+#include "Value/SparseMatrix.hpp"
+#include "Value/Value.hpp"
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace FusioCore {
+
+/**
+ * Valeur manipulée par l'interpréteur : scalaire, vecteur, matrice dense ou creuse
+ *
+ * L'alternative est stockée dans la valeur elle-même (std::variant) : un
+ * scalaire n'alloue rien, un vecteur ou une matrice ne copie que le pointeur
+ * partagé vers ses éléments (copie à l'écriture). Le type est lu dans l'index
+ * du variant (kind()) et les opérations sont réparties par std::visit, sans
+ * appel virtuel ni RTTI. Une valeur vide (std::monostate) représente
+ * l'absence de résultat.
+ *
+ * Une valeur se déplace mais ne se copie pas implicitement : chaque copie
+ * passe par copy(), de sorte qu'aucun transfert de l'interpréteur ne
+ * duplique une valeur par inadvertance.
+ */
+class Value {
+public:
+    using Storage = std::variant<std::monostate, Scalar, Vector, Matrix, SparseMatrix>;
+
+    Value() = default;
+    ~Value() = default;
+    
+    Value(Value&&) noexcept = default;
+    Value& operator=(Value&&) noexcept = default;
+    Value(const Value&) = delete;
+    Value& operator=(const Value&) = delete;
+    
+    // Copie explicite ; les éléments d'un vecteur ou d'une matrice sont partagés
+    Value copy() const;
+
+    // Conversions implicites : `return Scalar(x);` ou `Value v = 2.0;`
+    Value(double value) : storage_(std::in_place_type<Scalar>, value) {}
+    Value(Scalar value) : storage_(std::move(value)) {}
+    Value(Vector value) : storage_(std::move(value)) {}
+    Value(Matrix value) : storage_(std::move(value)) {}
+    Value(SparseMatrix value) : storage_(std::move(value)) {}
+
+    bool empty() const { return std::holds_alternative<std::monostate>(storage_); }
+    explicit operator bool() const { return !empty(); }
+
+    /**
+     * Type de la valeur, pour une répartition par switch
+     * @throw std::runtime_error si la valeur est vide
+     */
+    ValueKind kind() const {
+        if (empty()) {
+            throw std::runtime_error("Valeur vide");
+        }
+        return static_cast<ValueKind>(storage_.index() - 1);
+    }
+    
+    bool isScalar() const { return std::holds_alternative<Scalar>(storage_); }
+    bool isVector() const { return std::holds_alternative<Vector>(storage_); }
+    bool isMatrix() const { return std::holds_alternative<Matrix>(storage_); }
+    bool isSparse() const { return std::holds_alternative<SparseMatrix>(storage_); }
+
+    // Alternative T, nullptr si la valeur est d'un autre type
+    template <typename T>
+    const T* getIf() const { return std::get_if<T>(&storage_); }
+    template <typename T>
+    T* getIf() { return std::get_if<T>(&storage_); }
+
+    /**
+     * Alternative T de la valeur
+     * @return L'alternative, sans copie
+     * @throw std::runtime_error si la valeur est d'un autre type
+     */
+    template <typename T>
+    const T& as() const {
+        if (const T* value = getIf<T>()) {
+            return *value;
+        }
+        throw std::runtime_error(std::string("Valeur de type ") + typeName() + " inattendue");
+    }
+    template <typename T>
+    T& as() {
+        return const_cast<T&>(std::as_const(*this).as<T>());
+    }
+
+    // Valeur d'un scalaire
+    // @throw std::runtime_error si la valeur n'est pas un scalaire
+    double toDouble() const { return as<Scalar>().getValue(); }
+
+    // Appelle f avec l'alternative (std::monostate pour une valeur vide)
+    template <typename F>
+    decltype(auto) visit(F&& f) const { return std::visit(std::forward<F>(f), storage_); }
+    template <typename F>
+    decltype(auto) visit(F&& f) { return std::visit(std::forward<F>(f), storage_); }
+
+    const Storage& storage() const { return storage_; }
+
+    // Nom du type, pour les messages d'erreur
+    const char* typeName() const;
+
+    std::string toString() const;
+
+    /**
+     * Opérateurs arithmétiques, répartis par std::visit sur les deux
+     * alternatives (double répartition) vers les opérateurs de Scalar, Vector,
+     * Matrix et SparseMatrix ; le produit par un scalaire est commutatif.
+     * Amis cachés : ils ne sont trouvés que si l'un des opérandes est une Value.
+     * @throw std::runtime_error si l'opération n'est pas définie pour ces types
+     */
+    friend Value operator+(const Value& lhs, const Value& rhs) { return add(lhs, rhs); }
+    friend Value operator-(const Value& lhs, const Value& rhs) { return subtract(lhs, rhs); }
+    friend Value operator*(const Value& lhs, const Value& rhs) { return multiply(lhs, rhs); }
+    friend Value operator/(const Value& lhs, const Value& rhs) { return divide(lhs, rhs); }
+
+private:
+    static Value add(const Value& lhs, const Value& rhs);
+    static Value subtract(const Value& lhs, const Value& rhs);
+    static Value multiply(const Value& lhs, const Value& rhs);
+    static Value divide(const Value& lhs, const Value& rhs);
+
+    Storage storage_;
+};
+
+// kind() lit le type dans l'index du variant : les alternatives suivent l'ordre de ValueKind
+static_assert(std::variant_size_v<Value::Storage> == 5);
+static_assert(std::is_same_v<std::variant_alternative_t<1 + static_cast<size_t>(ValueKind::Scalar), Value::Storage>, Scalar>);
+static_assert(std::is_same_v<std::variant_alternative_t<1 + static_cast<size_t>(ValueKind::Vector), Value::Storage>, Vector>);
+static_assert(std::is_same_v<std::variant_alternative_t<1 + static_cast<size_t>(ValueKind::Matrix), Value::Storage>, Matrix>);
+static_assert(std::is_same_v<std::variant_alternative_t<1 + static_cast<size_t>(ValueKind::Sparse), Value::Storage>, SparseMatrix>);
+
+} // namespace FusioCore
+
+#endif // VARIANT_HPP
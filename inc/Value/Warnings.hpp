@@ -0,0 +1,28 @@
+#ifndef WARNINGS_HPP
+#define WARNINGS_HPP
+
+#include <string>
+#include <vector>
+
+namespace FusioCore {
+
+/**
+ * Avertissements numériques émis pendant une évaluation
+ *
+ * Un calcul qui aboutit mais dont le résultat peut être imprécis (matrice
+ * mal conditionnée...) le signale ici plutôt que d'échouer. Les messages
+ * sont conservés par thread : celui qui évalue une instruction les récupère
+ * avec take() une fois l'évaluation terminée.
+ */
+class Warnings {
+public:
+    // Ajoute un avertissement à ceux du thread courant
+    static void report(std::string message);
+    
+    // Retire et retourne les avertissements du thread courant, dans l'ordre d'émission
+    static std::vector<std::string> take();
+};
+
+} // namespace FusioCore
+
+#endif // WARNINGS_HPP
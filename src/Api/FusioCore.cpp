@@ -0,0 +1,322 @@
+#include "Api/FusioCore.h"
+#include "Expression/FusioInterpreter.hpp"
+#include "Expression/ProgramCache.hpp"
+#include "Value/Variant.hpp"
+#include <exception>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+using namespace FusioCore;
+
+// Les énumérations C reprennent l'ordre de DType et ValueKind
+static_assert(static_cast<int>(DType::F32) == FUSIO_F32 && static_cast<int>(DType::F64) == FUSIO_F64 &&
+              static_cast<int>(DType::I32) == FUSIO_I32 && static_cast<int>(DType::I64) == FUSIO_I64);
+static_assert(static_cast<int>(ValueKind::Scalar) == FUSIO_SCALAR &&
+              static_cast<int>(ValueKind::Vector) == FUSIO_VECTOR &&
+              static_cast<int>(ValueKind::Matrix) == FUSIO_MATRIX &&
+              static_cast<int>(ValueKind::Sparse) == FUSIO_SPARSE);
+static_assert(std::is_same_v<SparseMatrix::Storage::StorageIndex, int32_t>);
+
+struct fusio_session {
+    explicit fusio_session(std::shared_ptr<ProgramCache> cache)
+        : programs(std::move(cache)), interpreter(programs) {}
+    
+    std::shared_ptr<ProgramCache> programs;
+    FusioInterpreter interpreter;
+    std::string error;
+};
+
+struct fusio_value {
+    Value value;
+    std::string text;  // Dernier résultat de fusio_value_string
+};
+
+namespace {
+
+// Exécute operation en convertissant les exceptions en message d'erreur de la session
+template <typename Operation>
+fusio_status guarded(fusio_session* session, Operation&& operation) {
+    if (!session) {
+        return FUSIO_ERROR;
+    }
+    try {
+        operation();
+        session->error.clear();
+        return FUSIO_OK;
+    } catch (const std::exception& e) {
+        session->error = e.what();
+    } catch (...) {
+        session->error = "Erreur inconnue";
+    }
+    return FUSIO_ERROR;
+}
+
+void checkName(const char* name) {
+    if (!name || !*name) {
+        throw std::runtime_error("Nom de variable manquant");
+    }
+}
+
+DType toDType(fusio_dtype dtype) {
+    if (dtype < FUSIO_F32 || dtype > FUSIO_I64) {
+        throw std::runtime_error("Type d'éléments inconnu");
+    }
+    return static_cast<DType>(dtype);
+}
+
+void checkArray(const fusio_array* array) {
+    if (!array) {
+        throw std::runtime_error("Tableau manquant");
+    }
+    if (array->rows < 0 || array->cols < 0) {
+        throw std::runtime_error("Dimensions négatives");
+    }
+    if (array->row_stride <= 0 || array->col_stride <= 0) {
+        throw std::runtime_error("Les pas doivent être strictement positifs");
+    }
+    if (!array->data && array->rows > 0 && array->cols > 0) {
+        throw std::runtime_error("Éléments manquants");
+    }
+}
+
+// Copie d'un tableau à pas quelconques en ordre colonne
+template <typename T>
+MatrixOf<T> copyMatrix(const fusio_array& array) {
+    using Strides = Eigen::Stride<Eigen::Dynamic, Eigen::Dynamic>;
+    return Eigen::Map<const MatrixOf<T>, 0, Strides>(static_cast<const T*>(array.data), array.rows, array.cols,
+                                                     Strides(array.col_stride, array.row_stride));
+}
+
+Matrix borrowMatrix(const fusio_array& array, std::shared_ptr<const void> owner) {
+    const bool columnMajor = array.row_stride == 1 && array.col_stride == array.rows;
+    return dispatch(toDType(array.dtype), [&](auto tag) {
+        using T = typename decltype(tag)::type;
+        if constexpr (std::is_same_v<T, double>) {
+            return Matrix(static_cast<const double*>(array.data), array.rows, array.cols, array.col_stride,
+                          array.row_stride, std::move(owner));
+        } else {
+            // Seuls les éléments double ont un stockage externe à pas quelconques
+            if (columnMajor) {
+                return Matrix(static_cast<const T*>(array.data), array.rows, array.cols, std::move(owner));
+            }
+            return Matrix(copyMatrix<T>(array));
+        }
+    });
+}
+
+void describe(fusio_array& out, const void* data, Eigen::Index rows, Eigen::Index cols, Eigen::Index colStride,
+              DType dtype) {
+    out.data = data;
+    out.dtype = static_cast<fusio_dtype>(dtype);
+    out.rows = rows;
+    out.cols = cols;
+    out.row_stride = 1;
+    out.col_stride = colStride;
+}
+
+fusio_value* newValue(Value value) {
+    if (value.empty()) {
+        return nullptr;
+    }
+    return new fusio_value{std::move(value), {}};
+}
+
+} // namespace
+
+extern "C" {
+
+fusio_session* fusio_session_create(void) {
+    try {
+        return new fusio_session(std::make_shared<ProgramCache>());
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+fusio_session* fusio_session_create_shared(const fusio_session* peer) {
+    if (!peer) {
+        return fusio_session_create();
+    }
+    try {
+        return new fusio_session(peer->programs);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void fusio_session_destroy(fusio_session* session) {
+    delete session;
+}
+
+const char* fusio_session_error(const fusio_session* session) {
+    return session ? session->error.c_str() : "Session manquante";
+}
+
+fusio_status fusio_evaluate(fusio_session* session, const char* statement, fusio_value** result) {
+    if (result) {
+        *result = nullptr;
+    }
+    return guarded(session, [&] {
+        if (!statement) {
+            throw std::runtime_error("Instruction manquante");
+        }
+        Value value = session->interpreter.evaluate(statement);
+        if (result) {
+            *result = newValue(std::move(value));
+        }
+    });
+}
+
+fusio_status fusio_get_variable(fusio_session* session, const char* name, fusio_value** result) {
+    if (result) {
+        *result = nullptr;
+    }
+    return guarded(session, [&] {
+        checkName(name);
+        const Value* value = session->interpreter.getVariable(name);
+        if (!value) {
+            throw std::runtime_error(std::string("Variable inconnue : ") + name);
+        }
+        if (result) {
+            *result = newValue(value->copy());
+        }
+    });
+}
+
+fusio_status fusio_remove_variable(fusio_session* session, const char* name) {
+    return guarded(session, [&] {
+        checkName(name);
+        session->interpreter.removeVariable(name);
+    });
+}
+
+fusio_status fusio_set_scalar(fusio_session* session, const char* name, double value) {
+    return guarded(session, [&] {
+        checkName(name);
+        session->interpreter.setVariable(name, Value(value));
+    });
+}
+
+fusio_status fusio_set_matrix(fusio_session* session, const char* name, const fusio_array* array,
+                              fusio_release release, void* context) {
+    // Le propriétaire rend les éléments à l'appelant dès que la dernière matrice qui les référence disparaît
+    std::shared_ptr<const void> owner;
+    try {
+        owner = std::shared_ptr<const void>(context, [release](const void* borrowed) {
+            if (release) {
+                release(const_cast<void*>(borrowed));
+            }
+        });
+    } catch (...) {
+        // shared_ptr a déjà appelé release
+        if (session) {
+            session->error = "Mémoire insuffisante";
+        }
+        return FUSIO_ERROR;
+    }
+    
+    return guarded(session, [&] {
+        checkName(name);
+        checkArray(array);
+        session->interpreter.setVariable(name, Value(borrowMatrix(*array, std::move(owner))));
+    });
+}
+
+fusio_status fusio_set_vector(fusio_session* session, const char* name, const fusio_array* array) {
+    return guarded(session, [&] {
+        checkName(name);
+        checkArray(array);
+        if (array->cols != 1) {
+            throw std::runtime_error("Un vecteur a une seule colonne");
+        }
+        Vector vector = dispatch(toDType(array->dtype), [&](auto tag) {
+            using T = typename decltype(tag)::type;
+            VectorOf<T> elements = Eigen::Map<const VectorOf<T>, 0, Eigen::InnerStride<>>(
+                static_cast<const T*>(array->data), array->rows, Eigen::InnerStride<>(array->row_stride));
+            return Vector(std::move(elements));
+        });
+        session->interpreter.setVariable(name, Value(std::move(vector)));
+    });
+}
+
+fusio_kind fusio_value_kind(const fusio_value* value) {
+    return static_cast<fusio_kind>(value->value.kind());
+}
+
+fusio_status fusio_value_scalar(const fusio_value* value, double* out) {
+    if (!value || !out || !value->value.isScalar()) {
+        return FUSIO_ERROR;
+    }
+    *out = value->value.toDouble();
+    return FUSIO_OK;
+}
+
+fusio_status fusio_value_array(fusio_value* value, fusio_array* out) {
+    if (!value || !out) {
+        return FUSIO_ERROR;
+    }
+    try {
+        if (const Vector* vector = value->value.getIf<Vector>()) {
+            dispatch(vector->dtype(), [&](auto tag) {
+                using T = typename decltype(tag)::type;
+                auto elements = vector->getTypedData<T>();
+                describe(*out, elements.data(), elements.size(), 1, elements.size(), vector->dtype());
+            });
+            return FUSIO_OK;
+        }
+        if (Matrix* matrix = value->value.getIf<Matrix>()) {
+            // Après materialize, getTypedData référence les éléments de la valeur, sans copie
+            matrix->materialize();
+            dispatch(matrix->dtype(), [&](auto tag) {
+                using T = typename decltype(tag)::type;
+                auto elements = matrix->getTypedData<T>();
+                describe(*out, elements.data(), elements.rows(), elements.cols(), elements.outerStride(),
+                         matrix->dtype());
+            });
+            return FUSIO_OK;
+        }
+    } catch (...) {
+    }
+    return FUSIO_ERROR;
+}
+
+fusio_status fusio_value_sparse(const fusio_value* value, fusio_sparse* out) {
+    if (!value || !out || !value->value.isSparse()) {
+        return FUSIO_ERROR;
+    }
+    try {
+        // Lecture seule : le stockage, toujours compressé, reste partagé
+        const SparseMatrix::Storage& data = std::as_const(value->value).as<SparseMatrix>().getData();
+        out->rows = data.rows();
+        out->cols = data.cols();
+        out->nonzeros = data.nonZeros();
+        out->col_offsets = data.outerIndexPtr();
+        out->row_indices = data.innerIndexPtr();
+        out->values = data.valuePtr();
+        return FUSIO_OK;
+    } catch (...) {
+        return FUSIO_ERROR;
+    }
+}
+
+const char* fusio_value_string(fusio_value* value) {
+    if (!value) {
+        return "";
+    }
+    try {
+        value->text = value->value.toString();
+    } catch (...) {
+        value->text.clear();
+    }
+    return value->text.c_str();
+}
+
+void fusio_value_destroy(fusio_value* value) {
+    delete value;
+}
+
+} // extern "C"
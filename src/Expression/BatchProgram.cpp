@@ -0,0 +1,215 @@
+#include "Expression/BatchProgram.hpp"
+#include "Expression/Parser.hpp"
+#include <cmath>
+#include <map>
+#include <stdexcept>
+
+namespace FusioCore {
+
+namespace {
+
+// Fonctions de la grammaire native disponibles ligne par ligne, avec leur valeur scalaire
+struct RowFunction {
+    FunctionId id;
+    double (*apply)(double);
+};
+
+const std::map<std::string, RowFunction>& rowFunctions() {
+    static const std::map<std::string, RowFunction> table = {
+        {"sin", {FunctionId::Sin, [](double x) { return std::sin(x); }}},
+        {"cos", {FunctionId::Cos, [](double x) { return std::cos(x); }}},
+        {"tan", {FunctionId::Tan, [](double x) { return std::tan(x); }}},
+        {"exp", {FunctionId::Exp, [](double x) { return std::exp(x); }}},
+        {"log", {FunctionId::Log, [](double x) { return std::log(x); }}},
+        {"log10", {FunctionId::Log10, [](double x) { return std::log10(x); }}},
+        {"sqrt", {FunctionId::Sqrt, [](double x) { return std::sqrt(x); }}},
+        {"abs", {FunctionId::Abs, [](double x) { return std::abs(x); }}},
+    };
+    return table;
+}
+
+// Opérateur élément par élément équivalent ; false pour \ (sans sens ligne par ligne)
+bool rowOperator(BinaryOp op, BinaryOp& rowOp) {
+    switch (op) {
+        case BinaryOp::Add:
+        case BinaryOp::Sub:
+            rowOp = op;
+            return true;
+        case BinaryOp::Mul:
+        case BinaryOp::ElemMul:
+            rowOp = BinaryOp::ElemMul;
+            return true;
+        case BinaryOp::Div:
+        case BinaryOp::ElemDiv:
+            rowOp = BinaryOp::ElemDiv;
+            return true;
+        case BinaryOp::Pow:
+        case BinaryOp::ElemPow:
+            rowOp = BinaryOp::ElemPow;
+            return true;
+        case BinaryOp::LeftDiv:
+            return false;
+    }
+    return false;
+}
+
+double applyRowOperator(BinaryOp op, double a, double b) {
+    switch (op) {
+        case BinaryOp::Add: return a + b;
+        case BinaryOp::Sub: return a - b;
+        case BinaryOp::ElemMul: return a * b;
+        case BinaryOp::ElemDiv: return a / b;
+        default: return std::pow(a, b);
+    }
+}
+
+} // namespace
+
+std::unique_ptr<BatchProgram> BatchProgram::compile(const std::string& expression,
+                                                    const std::vector<std::string>& columns,
+                                                    IExpressionEvaluator& variables) {
+    AstPtr root;
+    try {
+        root = Parser::parse(expression);
+    } catch (const SyntaxError&) {
+        return nullptr;
+    }
+    
+    std::unique_ptr<BatchProgram> program(new BatchProgram());
+    program->columnRegisters_.assign(columns.size(), -1);
+    if (!program->compileNode(*root, columns, variables, program->result_)) {
+        return nullptr;
+    }
+    return program;
+}
+
+Eigen::Index BatchProgram::rowCount(const std::vector<BatchColumn>& columns) {
+    if (columns.empty()) {
+        throw std::runtime_error("Évaluation par lots sans colonne");
+    }
+    const Eigen::Index rows = columns.front().values.size();
+    for (const BatchColumn& column : columns) {
+        if (column.values.size() != rows) {
+            throw std::runtime_error("Colonnes de tailles différentes : " + columns.front().name + " (" +
+                                     std::to_string(rows) + ") et " + column.name + " (" +
+                                     std::to_string(column.values.size()) + ")");
+        }
+    }
+    return rows;
+}
+
+Eigen::VectorXd BatchProgram::run(const std::vector<BatchColumn>& columns) const {
+    const Eigen::Index rows = rowCount(columns);
+    if (result_.reg < 0) {
+        return Eigen::VectorXd::Constant(rows, result_.constant);
+    }
+    
+    // Les colonnes sont lues en place : Ref garantit des éléments consécutifs
+    std::vector<const double*> inputs;
+    inputs.reserve(inputs_.size());
+    for (size_t column : inputs_) {
+        inputs.push_back(columns[column].values.data());
+    }
+    
+    Eigen::VectorXd result(rows);
+    program_.run(inputs.data(), scalars_.data(), result.data(), rows);
+    return result;
+}
+
+bool BatchProgram::compileNode(const AstNode& node, const std::vector<std::string>& columns,
+                               IExpressionEvaluator& variables, Operand& result) {
+    switch (node.kind) {
+        case NodeKind::Number:
+            result.constant = node.number;
+            return true;
+        
+        case NodeKind::Variable: {
+            for (size_t i = 0; i < columns.size(); ++i) {
+                if (columns[i] == node.name) {
+                    result.reg = bindColumn(i);
+                    return true;
+                }
+            }
+            const Value* value = variables.getVariable(node.name);
+            if (!value || !value->isScalar()) {
+                return false;
+            }
+            result.constant = value->toDouble();
+            return true;
+        }
+        
+        case NodeKind::Unary: {
+            Operand x;
+            if (!compileNode(*node.children[0], columns, variables, x)) {
+                return false;
+            }
+            if (node.unaryOp != UnaryOp::Negate) {
+                result = x;
+            } else if (x.reg < 0) {
+                result.constant = -x.constant;
+            } else {
+                result.reg = program_.emitScalar(BinaryOp::ElemMul, x.reg, bindScalar(-1.0), false);
+            }
+            return true;
+        }
+        
+        case NodeKind::Transpose:
+            // Transposée d'un scalaire : sans effet
+            return compileNode(*node.children[0], columns, variables, result);
+        
+        case NodeKind::Call: {
+            auto it = rowFunctions().find(node.name);
+            Operand x;
+            if (it == rowFunctions().end() || node.children.size() != 1 ||
+                !compileNode(*node.children[0], columns, variables, x)) {
+                return false;
+            }
+            if (x.reg < 0) {
+                result.constant = it->second.apply(x.constant);
+            } else {
+                result.reg = program_.emitUnary(it->second.id, x.reg);
+            }
+            return true;
+        }
+        
+        case NodeKind::Binary: {
+            BinaryOp op;
+            Operand x;
+            Operand y;
+            if (!rowOperator(node.binaryOp, op) ||
+                !compileNode(*node.children[0], columns, variables, x) ||
+                !compileNode(*node.children[1], columns, variables, y)) {
+                return false;
+            }
+            if (x.reg < 0 && y.reg < 0) {
+                result.constant = applyRowOperator(op, x.constant, y.constant);
+            } else if (x.reg < 0) {
+                result.reg = program_.emitScalar(op, y.reg, bindScalar(x.constant), true);
+            } else if (y.reg < 0) {
+                result.reg = program_.emitScalar(op, x.reg, bindScalar(y.constant), false);
+            } else {
+                result.reg = program_.emitBinary(op, x.reg, y.reg);
+            }
+            return true;
+        }
+        
+        default:
+            // Indexations, plages, littéraux : pas de sens ligne par ligne
+            return false;
+    }
+}
+
+int BatchProgram::bindColumn(size_t column) {
+    if (columnRegisters_[column] < 0) {
+        columnRegisters_[column] = program_.addInput();
+        inputs_.push_back(column);
+    }
+    return columnRegisters_[column];
+}
+
+int BatchProgram::bindScalar(double value) {
+    scalars_.push_back(value);
+    return program_.addScalar();
+}
+
+} // namespace FusioCore
@@ -0,0 +1,1525 @@
+#include "Expression/BytecodeCompiler.hpp"
+#include "Expression/Parser.hpp"
+#include <cctype>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace FusioCore {
+
+namespace {
+
+constexpr double PI = 3.14159265358979323846;
+
+// Éléments d'un littéral, dans leur ordre de lecture
+using RowMajorMatrix = Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+// Fonctions reconnues par le moteur natif
+const std::map<std::string, FunctionId>& functionTable() {
+    static const std::map<std::string, FunctionId> table = {
+        {"sin", FunctionId::Sin},
+        {"cos", FunctionId::Cos},
+        {"tan", FunctionId::Tan},
+        {"exp", FunctionId::Exp},
+        {"log", FunctionId::Log},
+        {"log10", FunctionId::Log10},
+        {"sqrt", FunctionId::Sqrt},
+        {"abs", FunctionId::Abs},
+        {"det", FunctionId::Det},
+        {"inv", FunctionId::Inv},
+        {"trace", FunctionId::Trace},
+        {"norm", FunctionId::Norm},
+        {"sum", FunctionId::Sum},
+        {"transpose", FunctionId::Transpose},
+        {"solve", FunctionId::Solve},
+        {"sparse", FunctionId::Sparse},
+        {"full", FunctionId::Full},
+        {"nnz", FunctionId::Nnz},
+        {"cg", FunctionId::Cg},
+        {"bicgstab", FunctionId::BiCgStab},
+        {"single", FunctionId::Single},
+        {"double", FunctionId::Double},
+        {"int32", FunctionId::Int32},
+        {"int64", FunctionId::Int64},
+    };
+    return table;
+}
+
+bool isElementwise(FunctionId function) {
+    switch (function) {
+        case FunctionId::Sin:
+        case FunctionId::Cos:
+        case FunctionId::Tan:
+        case FunctionId::Exp:
+        case FunctionId::Log:
+        case FunctionId::Log10:
+        case FunctionId::Sqrt:
+        case FunctionId::Abs:
+        case FunctionId::Single:
+        case FunctionId::Double:
+        case FunctionId::Int32:
+        case FunctionId::Int64:
+            return true;
+        default:
+            return false;
+    }
+}
+
+const char* operatorSymbol(BinaryOp op) {
+    switch (op) {
+        case BinaryOp::Add: return "+";
+        case BinaryOp::Sub: return "-";
+        case BinaryOp::Mul: return "*";
+        case BinaryOp::Div: return "/";
+        case BinaryOp::Pow: return "^";
+        case BinaryOp::ElemMul: return ".*";
+        case BinaryOp::ElemDiv: return "./";
+        case BinaryOp::ElemPow: return ".^";
+        case BinaryOp::LeftDiv: return "\\";
+    }
+    return "?";
+}
+
+std::string dimensions(const AstNode& node) {
+    return std::to_string(node.rows) + "x" + std::to_string(node.cols);
+}
+
+void setType(AstNode& node, ValueKind type, Eigen::Index rows, Eigen::Index cols) {
+    node.type = type;
+    node.rows = rows;
+    node.cols = cols;
+}
+
+void copyType(AstNode& node, const AstNode& from) {
+    setType(node, from.type, from.rows, from.cols);
+}
+
+DType valueDType(const Value& value) {
+    if (const auto* vector = value.getIf<Vector>()) {
+        return vector->dtype();
+    }
+    if (const auto* matrix = value.getIf<Matrix>()) {
+        return matrix->dtype();
+    }
+    return DType::F64;
+}
+
+// Type des éléments d'un nœud typé : un scalaire (ou une matrice creuse) est
+// en double, un scalaire ne change pas le type de l'autre opérande
+DType elementType(const AstNode& node) {
+    if (node.type == ValueKind::Scalar || node.type == ValueKind::Sparse) {
+        return DType::F64;
+    }
+    switch (node.kind) {
+        case NodeKind::Variable:
+            return valueDType(*node.value);
+        
+        case NodeKind::Unary:
+        case NodeKind::Transpose:
+            return node.children[0]->dtype;
+        
+        case NodeKind::Binary: {
+            const AstNode& lhs = *node.children[0];
+            const AstNode& rhs = *node.children[1];
+            if (lhs.isScalar()) {
+                return rhs.dtype;
+            }
+            if (rhs.isScalar()) {
+                return lhs.dtype;
+            }
+            const DType common = promote(lhs.dtype, rhs.dtype);
+            return node.binaryOp == BinaryOp::LeftDiv ? floating(common) : common;
+        }
+        
+        case NodeKind::Call:
+            switch (node.function) {
+                case FunctionId::Single: return DType::F32;
+                case FunctionId::Double: return DType::F64;
+                case FunctionId::Int32: return DType::I32;
+                case FunctionId::Int64: return DType::I64;
+                case FunctionId::Abs:
+                case FunctionId::Full:
+                    return node.children[0]->dtype;
+                case FunctionId::Sin:
+                case FunctionId::Cos:
+                case FunctionId::Tan:
+                case FunctionId::Exp:
+                case FunctionId::Log:
+                case FunctionId::Log10:
+                case FunctionId::Sqrt:
+                case FunctionId::Inv:
+                    return floating(node.children[0]->dtype);
+                default:
+                    return DType::F64;
+            }
+        
+        default:
+            return DType::F64;
+    }
+}
+
+// Indique si un sous-arbre lit un vecteur ou une matrice
+bool containsArray(const AstNode& node) {
+    if (node.kind == NodeKind::Literal || (node.kind == NodeKind::Variable && node.value && !node.value->isScalar())) {
+        return true;
+    }
+    for (const auto& child : node.children) {
+        if (containsArray(*child)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+BytecodeCompiler::BytecodeCompiler(IExpressionEvaluator& variables) : variables_(variables) {}
+
+std::shared_ptr<const Program> BytecodeCompiler::compile(const std::string& statement) {
+    program_ = std::make_shared<Program>();
+    guards_.clear();
+    
+    std::string expression = statement;
+    std::string target;
+    if (splitAssignment(statement, target, expression)) {
+        program_->target = target;
+    }
+    
+    AstPtr root = prepare(expression);
+    if (root->isScalar()) {
+        program_->result = compileScalar(*root);
+    } else if (compileView(*root)) {
+        // Sous-matrice ou transposée d'une variable : vue sur ses éléments
+    } else if (root->kind == NodeKind::Variable) {
+        // Valeur existante : retournée telle quelle, ou copiée par une assignation
+        program_->result = operand(*root);
+    } else if (root->type == ValueKind::Sparse) {
+        program_->result = compileSparse(*root);
+    } else {
+        // Évaluation directe dans le stockage du résultat, converti à la fin vers son type
+        program_->result = addRegister(root->type, root->rows, root->cols, RegisterStorage::Result);
+        program_->dtype = root->dtype;
+        compileInto(*root, program_->result);
+    }
+    
+    std::shared_ptr<const Program> program = std::move(program_);
+    program_.reset();
+    return program;
+}
+
+AstPtr BytecodeCompiler::prepare(const std::string& expression) {
+    AstPtr root;
+    try {
+        root = Parser::parse(expression);
+    } catch (const SyntaxError&) {
+        // Hors de la grammaire native : confié à l'évaluateur scalaire
+        root = std::make_unique<AstNode>();
+        makeFallback(*root, expression);
+        return root;
+    }
+    
+    bool hasArray = false;
+    resolveVariables(*root, hasArray);
+    if (hasArray || root->kind == NodeKind::Variable) {
+        typeNode(*root);
+        return root;
+    }
+    
+    // Expression scalaire : fonctions et constantes inconnues du moteur natif
+    // restent disponibles via l'évaluateur scalaire
+    try {
+        typeNode(*root);
+    } catch (const std::runtime_error&) {
+        makeFallback(*root, expression);
+    }
+    return root;
+}
+
+void BytecodeCompiler::resolveVariables(AstNode& node, bool& hasArray, bool inIndex) {
+    if (node.kind == NodeKind::Call) {
+        const Value* value = variables_.getVariable(node.name);
+        if (value && !value->isScalar()) {
+            // A(i, j) : la variable devient le premier enfant de l'indexation
+            auto variable = std::make_unique<AstNode>();
+            variable->kind = NodeKind::Variable;
+            variable->name = node.name;
+            resolveVariables(*variable, hasArray);
+            node.kind = NodeKind::Index;
+            node.children.insert(node.children.begin(), std::move(variable));
+            for (size_t i = 1; i < node.children.size(); ++i) {
+                resolveVariables(*node.children[i], hasArray, true);
+            }
+            return;
+        }
+    }
+    
+    if (node.kind == NodeKind::Variable && inIndex && node.name == "end") {
+        // Dernier indice de la dimension indexée
+        return;
+    }
+    if (node.kind == NodeKind::Variable) {
+        node.value = variables_.getVariable(node.name);
+        if (node.value && !node.value->isScalar()) {
+            hasArray = true;
+        }
+        
+        if (guards_.find(node.name) == guards_.end()) {
+            VariableGuard guard;
+            guard.name = node.name;
+            guard.defined = node.value != nullptr;
+            if (const Vector* vector = node.value ? node.value->getIf<Vector>() : nullptr) {
+                guard.type = ValueKind::Vector;
+                guard.rows = static_cast<Eigen::Index>(vector->size());
+                guard.dtype = vector->dtype();
+            } else if (const Matrix* matrix = node.value ? node.value->getIf<Matrix>() : nullptr) {
+                guard.type = ValueKind::Matrix;
+                guard.rows = static_cast<Eigen::Index>(matrix->rows());
+                guard.cols = static_cast<Eigen::Index>(matrix->cols());
+                guard.dtype = matrix->dtype();
+            } else if (const SparseMatrix* sparse = node.value ? node.value->getIf<SparseMatrix>() : nullptr) {
+                guard.type = ValueKind::Sparse;
+                guard.rows = static_cast<Eigen::Index>(sparse->rows());
+                guard.cols = static_cast<Eigen::Index>(sparse->cols());
+            }
+            guards_[node.name] = static_cast<int>(program_->variables.size());
+            program_->variables.push_back(guard);
+        }
+    } else if (node.kind == NodeKind::Literal) {
+        hasArray = true;
+    }
+    
+    for (auto& child : node.children) {
+        resolveVariables(*child, hasArray, inIndex);
+    }
+}
+
+void BytecodeCompiler::typeNode(AstNode& node) {
+    if (node.kind == NodeKind::Literal) {
+        typeLiteral(node);
+        return;
+    }
+    if (node.kind == NodeKind::Index) {
+        typeIndex(node);
+        return;
+    }
+    if (node.kind == NodeKind::Range) {
+        throw std::runtime_error("Plage d'indices hors d'une indexation");
+    }
+    
+    for (auto& child : node.children) {
+        typeNode(*child);
+    }
+    
+    switch (node.kind) {
+        case NodeKind::Number:
+        case NodeKind::Fallback:
+            setType(node, ValueKind::Scalar, 1, 1);
+            break;
+        
+        case NodeKind::Variable: {
+            if (!node.value) {
+                if (node.name == "pi") {
+                    node.number = PI;
+                } else if (node.name == "inf") {
+                    node.number = std::numeric_limits<double>::infinity();
+                } else {
+                    throw std::runtime_error("Variable non définie : " + node.name);
+                }
+                setType(node, ValueKind::Scalar, 1, 1);
+            } else {
+                const VariableGuard& guard = program_->variables[guards_.at(node.name)];
+                if (node.value->empty()) {
+                    throw std::runtime_error("Type de variable non supporté : " + node.name);
+                }
+                setType(node, guard.type, guard.rows, guard.cols);
+            }
+            break;
+        }
+        
+        case NodeKind::Unary:
+            copyType(node, *node.children[0]);
+            break;
+        
+        case NodeKind::Transpose: {
+            const AstNode& operand = *node.children[0];
+            if (operand.isScalar()) {
+                setType(node, ValueKind::Scalar, 1, 1);
+            } else {
+                const bool sparse = operand.type == ValueKind::Sparse;
+                setType(node, sparse ? ValueKind::Sparse : ValueKind::Matrix, operand.cols, operand.rows);
+            }
+            break;
+        }
+        
+        case NodeKind::Binary:
+            typeBinary(node);
+            break;
+        
+        case NodeKind::Call:
+            typeCall(node);
+            break;
+        
+        case NodeKind::Literal:
+        case NodeKind::Index:
+        case NodeKind::Range:
+            break;
+    }
+    node.dtype = elementType(node);
+}
+
+void BytecodeCompiler::typeBinary(AstNode& node) {
+    const AstNode& lhs = *node.children[0];
+    const AstNode& rhs = *node.children[1];
+    
+    auto mismatch = [&]() {
+        return std::runtime_error(std::string("Dimensions incompatibles pour ") + operatorSymbol(node.binaryOp) +
+                                  " : " + dimensions(lhs) + " et " + dimensions(rhs));
+    };
+    
+    if (lhs.isScalar() && rhs.isScalar()) {
+        setType(node, ValueKind::Scalar, 1, 1);
+        return;
+    }
+    if (lhs.type == ValueKind::Sparse || rhs.type == ValueKind::Sparse) {
+        typeSparseBinary(node);
+        return;
+    }
+    
+    switch (node.binaryOp) {
+        case BinaryOp::Add:
+        case BinaryOp::Sub:
+        case BinaryOp::ElemMul:
+        case BinaryOp::ElemDiv:
+        case BinaryOp::ElemPow:
+            // Diffusion des scalaires, sinon dimensions identiques
+            if (lhs.isScalar()) {
+                copyType(node, rhs);
+            } else if (rhs.isScalar()) {
+                copyType(node, lhs);
+            } else if (lhs.rows == rhs.rows && lhs.cols == rhs.cols) {
+                bool vectors = lhs.type == ValueKind::Vector && rhs.type == ValueKind::Vector;
+                setType(node, vectors ? ValueKind::Vector : ValueKind::Matrix, lhs.rows, lhs.cols);
+            } else {
+                throw mismatch();
+            }
+            break;
+        
+        case BinaryOp::Mul:
+            if (lhs.isScalar()) {
+                copyType(node, rhs);
+            } else if (rhs.isScalar()) {
+                copyType(node, lhs);
+            } else if (lhs.type == ValueKind::Vector && rhs.type == ValueKind::Vector) {
+                // Produit scalaire
+                if (lhs.rows != rhs.rows) {
+                    throw mismatch();
+                }
+                setType(node, ValueKind::Scalar, 1, 1);
+            } else if (lhs.cols != rhs.rows) {
+                throw mismatch();
+            } else if (lhs.rows == 1 && rhs.cols == 1) {
+                setType(node, ValueKind::Scalar, 1, 1);
+            } else if (rhs.type == ValueKind::Vector) {
+                setType(node, ValueKind::Vector, lhs.rows, 1);
+            } else {
+                setType(node, ValueKind::Matrix, lhs.rows, rhs.cols);
+            }
+            break;
+        
+        case BinaryOp::Div:
+            if (!rhs.isScalar()) {
+                throw std::runtime_error("Division par un vecteur ou une matrice non supportée (utiliser ./)");
+            }
+            copyType(node, lhs);
+            break;
+        
+        case BinaryOp::Pow:
+            if (!rhs.isScalar() || lhs.type != ValueKind::Matrix || lhs.rows != lhs.cols) {
+                throw std::runtime_error("La puissance matricielle requiert une matrice carrée et un exposant scalaire (utiliser .^)");
+            }
+            copyType(node, lhs);
+            break;
+        
+        case BinaryOp::LeftDiv:
+            if (lhs.isScalar()) {
+                // s \ X est équivalent à X / s
+                std::swap(node.children[0], node.children[1]);
+                node.binaryOp = BinaryOp::Div;
+                copyType(node, rhs);
+            } else if (lhs.type != ValueKind::Matrix || rhs.isScalar()) {
+                throw std::runtime_error("La résolution A \\ b requiert une matrice A et un vecteur ou une matrice b");
+            } else if (lhs.rows != rhs.rows) {
+                throw mismatch();
+            } else if (rhs.type == ValueKind::Vector) {
+                setType(node, ValueKind::Vector, lhs.cols, 1);
+            } else {
+                setType(node, ValueKind::Matrix, lhs.cols, rhs.cols);
+            }
+            break;
+    }
+}
+
+FunctionId BytecodeCompiler::lookupFunction(const std::string& name) {
+    auto it = functionTable().find(name);
+    return it != functionTable().end() ? it->second : FunctionId::Unknown;
+}
+
+bool BytecodeCompiler::splitAssignment(const std::string& statement, std::string& name, std::string& expression) {
+    const size_t length = statement.length();
+    size_t i = 0;
+    while (i < length && std::isspace(static_cast<unsigned char>(statement[i]))) {
+        ++i;
+    }
+    if (i == length || !std::isalpha(static_cast<unsigned char>(statement[i]))) {
+        return false;
+    }
+    
+    size_t begin = i;
+    while (i < length && (std::isalnum(static_cast<unsigned char>(statement[i])) || statement[i] == '_')) {
+        ++i;
+    }
+    size_t end = i;
+    while (i < length && std::isspace(static_cast<unsigned char>(statement[i]))) {
+        ++i;
+    }
+    
+    // "x == y" est une comparaison, pas une assignation
+    if (i == length || statement[i] != '=' || (i + 1 < length && statement[i + 1] == '=')) {
+        return false;
+    }
+    name = statement.substr(begin, end - begin);
+    expression = statement.substr(i + 1);
+    return true;
+}
+
+void BytecodeCompiler::typeCall(AstNode& node) {
+    const FunctionId function = lookupFunction(node.name);
+    if (function == FunctionId::Unknown) {
+        throw std::runtime_error("Fonction inconnue : " + node.name);
+    }
+    if (function == FunctionId::Solve) {
+        // solve(A, b) est équivalent à A \ b
+        if (node.children.size() != 2) {
+            throw std::runtime_error("La fonction solve attend deux arguments");
+        }
+        node.kind = NodeKind::Binary;
+        node.binaryOp = BinaryOp::LeftDiv;
+        typeBinary(node);
+        return;
+    }
+    node.function = function;
+    if (node.function == FunctionId::Sparse || node.function == FunctionId::Cg ||
+        node.function == FunctionId::BiCgStab) {
+        typeSparseCall(node);
+        return;
+    }
+    if (node.children.size() != 1) {
+        throw std::runtime_error("La fonction " + node.name + " attend un argument");
+    }
+    
+    const AstNode& operand = *node.children[0];
+    const bool sparse = operand.type == ValueKind::Sparse;
+    if (sparse && (isElementwise(node.function) || node.function == FunctionId::Inv)) {
+        throw std::runtime_error("La fonction " + node.name + " n'est pas supportée pour une matrice creuse (utiliser full)");
+    }
+    
+    if (isElementwise(node.function) || operand.isScalar()) {
+        copyType(node, operand);
+        return;
+    }
+    
+    switch (node.function) {
+        case FunctionId::Transpose:
+            // transpose(X) est équivalent à X'
+            node.kind = NodeKind::Transpose;
+            setType(node, sparse ? ValueKind::Sparse : ValueKind::Matrix, operand.cols, operand.rows);
+            break;
+        
+        case FunctionId::Full:
+            setType(node, sparse ? ValueKind::Matrix : operand.type, operand.rows, operand.cols);
+            break;
+        
+        case FunctionId::Det:
+        case FunctionId::Inv:
+            if (operand.rows != operand.cols) {
+                throw std::runtime_error("La fonction " + node.name + " requiert une matrice carrée (" +
+                                         dimensions(operand) + ")");
+            }
+            if (node.function == FunctionId::Det) {
+                setType(node, ValueKind::Scalar, 1, 1);
+            } else {
+                copyType(node, operand);
+            }
+            break;
+        
+        default:
+            // trace, norm, sum, nnz : réductions vers un scalaire
+            setType(node, ValueKind::Scalar, 1, 1);
+            break;
+    }
+}
+
+void BytecodeCompiler::typeLiteral(AstNode& node) {
+    // La forme du littéral est fixée par le Parser ; les éléments sont scalaires
+    for (auto& child : node.children) {
+        try {
+            typeNode(*child);
+        } catch (const std::runtime_error&) {
+            if (containsArray(*child)) {
+                throw;
+            }
+            makeFallback(*child, child->source);
+        }
+        if (!child->isScalar()) {
+            throw std::runtime_error(node.type == ValueKind::Vector
+                                     ? "Les éléments d'un vecteur doivent être des scalaires"
+                                     : "Les éléments d'une matrice doivent être des scalaires");
+        }
+    }
+}
+
+void BytecodeCompiler::typeIndex(AstNode& node) {
+    const AstNode& variable = *node.children[0];
+    typeNode(*node.children[0]);
+    const size_t count = node.children.size() - 1;
+    
+    if (variable.type == ValueKind::Sparse) {
+        throw std::runtime_error("L'indexation d'une matrice creuse n'est pas supportée (utiliser full)");
+    }
+    if (variable.type == ValueKind::Vector) {
+        if (count != 1) {
+            throw std::runtime_error("L'indexation du vecteur " + variable.name + " attend un indice");
+        }
+        bool single = false;
+        node.rowRange = indexRange(*node.children[1], variable.rows, single);
+        node.colRange = {0, 1, 1};
+        if (single) {
+            setType(node, ValueKind::Scalar, 1, 1);
+        } else {
+            setType(node, ValueKind::Vector, node.rowRange.size, 1);
+            node.dtype = variable.dtype;
+        }
+        return;
+    }
+    
+    if (count != 2) {
+        throw std::runtime_error("L'indexation de la matrice " + variable.name + " attend deux indices");
+    }
+    bool singleRow = false;
+    bool singleCol = false;
+    node.rowRange = indexRange(*node.children[1], variable.rows, singleRow);
+    node.colRange = indexRange(*node.children[2], variable.cols, singleCol);
+    if (singleRow && singleCol) {
+        setType(node, ValueKind::Scalar, 1, 1);
+    } else {
+        setType(node, ValueKind::Matrix, node.rowRange.size, node.colRange.size);
+        node.dtype = variable.dtype;
+    }
+}
+
+void BytecodeCompiler::typeSparseBinary(AstNode& node) {
+    const AstNode& lhs = *node.children[0];
+    const AstNode& rhs = *node.children[1];
+    const bool lhsSparse = lhs.type == ValueKind::Sparse;
+    const bool rhsSparse = rhs.type == ValueKind::Sparse;
+    
+    auto mismatch = [&]() {
+        return std::runtime_error(std::string("Dimensions incompatibles pour ") + operatorSymbol(node.binaryOp) +
+                                  " : " + dimensions(lhs) + " et " + dimensions(rhs));
+    };
+    
+    switch (node.binaryOp) {
+        case BinaryOp::Add:
+        case BinaryOp::Sub:
+            // Creuse + creuse reste creuse ; creuse + dense est dense
+            if (lhs.isScalar() || rhs.isScalar()) {
+                throw std::runtime_error("L'ajout d'un scalaire à une matrice creuse n'est pas supporté (utiliser full)");
+            }
+            if (lhs.rows != rhs.rows || lhs.cols != rhs.cols) {
+                throw mismatch();
+            }
+            setType(node, lhsSparse && rhsSparse ? ValueKind::Sparse : ValueKind::Matrix, lhs.rows, lhs.cols);
+            return;
+        
+        case BinaryOp::Mul:
+            if (lhs.isScalar()) {
+                copyType(node, rhs);
+            } else if (rhs.isScalar()) {
+                copyType(node, lhs);
+            } else if (lhs.cols != rhs.rows) {
+                throw mismatch();
+            } else if (lhsSparse && rhsSparse) {
+                setType(node, ValueKind::Sparse, lhs.rows, rhs.cols);
+            } else if (lhs.rows == 1 && rhs.cols == 1) {
+                setType(node, ValueKind::Scalar, 1, 1);
+            } else if (rhs.type == ValueKind::Vector) {
+                setType(node, ValueKind::Vector, lhs.rows, 1);
+            } else {
+                setType(node, ValueKind::Matrix, lhs.rows, rhs.cols);
+            }
+            return;
+        
+        case BinaryOp::Div:
+            if (!rhs.isScalar()) {
+                throw std::runtime_error("Division par une matrice creuse non supportée");
+            }
+            copyType(node, lhs);
+            return;
+        
+        case BinaryOp::LeftDiv:
+            if (!lhsSparse || rhsSparse) {
+                throw std::runtime_error("La résolution creuse A \\ b requiert une matrice creuse A et un second membre dense");
+            }
+            if (lhs.rows != lhs.cols) {
+                throw std::runtime_error("La résolution creuse requiert une matrice carrée (" + dimensions(lhs) + ")");
+            }
+            if (lhs.rows != rhs.rows) {
+                throw mismatch();
+            }
+            setType(node, rhs.type == ValueKind::Vector ? ValueKind::Vector : ValueKind::Matrix, lhs.cols, rhs.cols);
+            return;
+        
+        default:
+            throw std::runtime_error(std::string("Opération non supportée pour une matrice creuse : ") +
+                                     operatorSymbol(node.binaryOp) + " (utiliser full)");
+    }
+}
+
+void BytecodeCompiler::typeSparseCall(AstNode& node) {
+    const size_t count = node.children.size();
+    
+    if (node.function == FunctionId::Sparse) {
+        if (count == 1) {
+            // sparse(A) : conversion d'une matrice ou d'un vecteur dense
+            const AstNode& operand = *node.children[0];
+            if (operand.isScalar()) {
+                throw std::runtime_error("La fonction sparse attend une matrice, un vecteur ou des triplets");
+            }
+            setType(node, ValueKind::Sparse, operand.rows, operand.cols);
+            return;
+        }
+        if (count != 2 && count != 5) {
+            throw std::runtime_error("La fonction sparse attend sparse(A), sparse(m, n) ou sparse(i, j, v, m, n)");
+        }
+        
+        // Dimensions fixées à la compilation, comme des indices
+        const double rows = foldIndex(*node.children[count - 2], 0);
+        const double cols = foldIndex(*node.children[count - 1], 0);
+        if (rows < 0.0 || cols < 0.0 || rows != std::floor(rows) || cols != std::floor(cols)) {
+            throw std::runtime_error("Les dimensions d'une matrice creuse doivent être des entiers positifs");
+        }
+        if (count == 5) {
+            // Triplets : vecteurs de même longueur, ou scalaires répétés
+            Eigen::Index length = 1;
+            for (size_t i = 0; i < 3; ++i) {
+                const AstNode& argument = *node.children[i];
+                if (argument.type != ValueKind::Scalar && argument.type != ValueKind::Vector) {
+                    throw std::runtime_error("Les triplets de sparse(i, j, v, m, n) doivent être des vecteurs ou des scalaires");
+                }
+                if (argument.type == ValueKind::Vector) {
+                    if (length > 1 && argument.rows != length) {
+                        throw std::runtime_error("Les vecteurs i, j et v de sparse(i, j, v, m, n) doivent avoir la même longueur");
+                    }
+                    length = argument.rows;
+                }
+            }
+        }
+        setType(node, ValueKind::Sparse, static_cast<Eigen::Index>(rows), static_cast<Eigen::Index>(cols));
+        return;
+    }
+    
+    // cg(A, b [, tol [, maxit]]) et bicgstab(A, b [, tol [, maxit]])
+    if (count < 2 || count > 4) {
+        throw std::runtime_error("La fonction " + node.name + " attend " + node.name + "(A, b [, tol [, maxit]])");
+    }
+    const AstNode& matrix = *node.children[0];
+    const AstNode& rhs = *node.children[1];
+    if (matrix.type != ValueKind::Sparse) {
+        throw std::runtime_error("La fonction " + node.name + " requiert une matrice creuse (utiliser sparse(A))");
+    }
+    if (matrix.rows != matrix.cols) {
+        throw std::runtime_error("La fonction " + node.name + " requiert une matrice carrée (" + dimensions(matrix) + ")");
+    }
+    // Vecteur ou matrice colonne
+    const bool column = rhs.type == ValueKind::Vector || (rhs.type == ValueKind::Matrix && rhs.cols == 1);
+    if (!column || rhs.rows != matrix.rows) {
+        throw std::runtime_error("Le second membre de " + node.name + " doit être un vecteur de " +
+                                 std::to_string(matrix.rows) + " éléments");
+    }
+    for (size_t i = 2; i < count; ++i) {
+        if (!node.children[i]->isScalar()) {
+            throw std::runtime_error("La tolérance et le nombre d'itérations de " + node.name + " doivent être des scalaires");
+        }
+    }
+    setType(node, ValueKind::Vector, matrix.rows, 1);
+}
+
+Matrix::Range BytecodeCompiler::indexRange(const AstNode& argument, Eigen::Index extent, bool& single) {
+    auto toIndex = [&](double value) {
+        if (value != std::floor(value)) {
+            throw std::runtime_error("Indice non entier : " + std::to_string(value));
+        }
+        if (value < 1.0 || value > static_cast<double>(extent)) {
+            throw std::runtime_error("Indice hors limites : " + std::to_string(static_cast<long long>(value)) +
+                                     " (dimension " + std::to_string(extent) + ")");
+        }
+        return static_cast<Eigen::Index>(value) - 1;
+    };
+    
+    single = argument.kind != NodeKind::Range;
+    if (single) {
+        return {toIndex(foldIndex(argument, extent)), 1, 1};
+    }
+    if (argument.children.empty()) {
+        return {0, extent, 1};
+    }
+    
+    const bool stepped = argument.children.size() == 3;
+    const double first = foldIndex(*argument.children[0], extent);
+    const double step = stepped ? foldIndex(*argument.children[1], extent) : 1.0;
+    const double last = foldIndex(*argument.children.back(), extent);
+    if (step < 1.0 || step != std::floor(step)) {
+        throw std::runtime_error("Le pas d'une plage d'indices doit être un entier strictement positif");
+    }
+    if (last < first) {
+        return {0, 0, 1};
+    }
+    
+    Matrix::Range range;
+    range.first = toIndex(first);
+    range.step = static_cast<Eigen::Index>(step);
+    range.size = static_cast<Eigen::Index>(std::floor((last - first) / step)) + 1;
+    toIndex(first + static_cast<double>((range.size - 1) * range.step));
+    return range;
+}
+
+double BytecodeCompiler::foldIndex(const AstNode& node, Eigen::Index extent) {
+    switch (node.kind) {
+        case NodeKind::Number:
+            return node.number;
+        
+        case NodeKind::Variable:
+            if (node.name == "end") {
+                return static_cast<double>(extent);
+            }
+            if (node.value && node.value->isScalar()) {
+                // La valeur est fixée dans le programme : elle devient une garde
+                VariableGuard& guard = program_->variables[guards_.at(node.name)];
+                guard.pinned = true;
+                guard.value = node.value->toDouble();
+                return guard.value;
+            }
+            break;
+        
+        case NodeKind::Unary: {
+            const double value = foldIndex(*node.children[0], extent);
+            return node.unaryOp == UnaryOp::Negate ? -value : value;
+        }
+        
+        case NodeKind::Binary: {
+            const double a = foldIndex(*node.children[0], extent);
+            const double b = foldIndex(*node.children[1], extent);
+            switch (node.binaryOp) {
+                case BinaryOp::Add: return a + b;
+                case BinaryOp::Sub: return a - b;
+                case BinaryOp::Mul:
+                case BinaryOp::ElemMul: return a * b;
+                case BinaryOp::Div:
+                case BinaryOp::ElemDiv: return a / b;
+                case BinaryOp::Pow:
+                case BinaryOp::ElemPow: return std::pow(a, b);
+                case BinaryOp::LeftDiv: return b / a;
+            }
+            break;
+        }
+        
+        default:
+            break;
+    }
+    throw std::runtime_error("Valeur non constante (indice, dimension) : seuls les nombres, les variables scalaires et end sont admis");
+}
+
+void BytecodeCompiler::makeFallback(AstNode& node, const std::string& source) {
+    if (!variables_.isValid(source)) {
+        throw std::runtime_error("Expression invalide: " + source);
+    }
+    node.kind = NodeKind::Fallback;
+    node.children.clear();
+    node.source = source;
+    setType(node, ValueKind::Scalar, 1, 1);
+}
+
+int BytecodeCompiler::addRegister(ValueKind type, Eigen::Index rows, Eigen::Index cols, RegisterStorage storage) {
+    RegisterInfo reg;
+    reg.type = type;
+    reg.rows = rows;
+    reg.cols = cols;
+    reg.storage = storage;
+    program_->registers.push_back(reg);
+    return static_cast<int>(program_->registers.size()) - 1;
+}
+
+int BytecodeCompiler::addOffset(Eigen::Index offset) {
+    program_->offsets.push_back(offset);
+    return static_cast<int>(program_->offsets.size()) - 1;
+}
+
+int BytecodeCompiler::temporaryFor(const AstNode& node) {
+    return addRegister(node.type, node.rows, node.cols);
+}
+
+void BytecodeCompiler::emit(OpCode op, int dst, int a, int b, Coefficient coef, int aux) {
+    Instruction instruction;
+    instruction.op = op;
+    instruction.dst = dst;
+    instruction.a = a;
+    instruction.b = b;
+    instruction.scale = coef.scale;
+    instruction.constant = coef.constant;
+    instruction.aux = aux;
+    program_->code.push_back(instruction);
+}
+
+bool BytecodeCompiler::compileView(const AstNode& root) {
+    SliceInfo slice;
+    const AstNode* node = &root;
+    if (node->kind == NodeKind::Transpose) {
+        slice.transposed = true;
+        node = node->children[0].get();
+    }
+    
+    const AstNode* source = node;
+    if (node->kind == NodeKind::Index) {
+        source = node->children[0].get();
+        slice.rows = node->rowRange;
+        slice.cols = node->colRange;
+    } else if (slice.transposed) {
+        slice.rows = {0, node->rows, 1};
+        slice.cols = {0, node->cols, 1};
+    } else {
+        return false;
+    }
+    if (source->kind != NodeKind::Variable || !source->value || source->type != ValueKind::Matrix) {
+        return false;
+    }
+    
+    // Registre de la variable sans lien vers ses données : la vue est
+    // construite sur la valeur, qui n'a pas à être contiguë
+    const int index = guards_.at(source->name);
+    const VariableGuard& guard = program_->variables[index];
+    program_->result = addRegister(guard.type, guard.rows, guard.cols, RegisterStorage::Variable);
+    program_->registers[program_->result].variable = index;
+    program_->slices.push_back(slice);
+    program_->view = static_cast<int>(program_->slices.size()) - 1;
+    return true;
+}
+
+int BytecodeCompiler::compileScalar(const AstNode& node) {
+    switch (node.kind) {
+        case NodeKind::Number: {
+            int dst = addRegister(ValueKind::Scalar, 1, 1);
+            emit(OpCode::LoadConstant, dst, -1, -1, {node.number, -1});
+            return dst;
+        }
+        
+        case NodeKind::Variable:
+            if (!node.value) {
+                // Constante (pi, inf)
+                int dst = addRegister(ValueKind::Scalar, 1, 1);
+                emit(OpCode::LoadConstant, dst, -1, -1, {node.number, -1});
+                return dst;
+            }
+            return operand(node);
+        
+        case NodeKind::Fallback: {
+            int dst = addRegister(ValueKind::Scalar, 1, 1);
+            program_->sources.push_back(node.source);
+            emit(OpCode::ScalarFallback, dst, -1, -1, {}, static_cast<int>(program_->sources.size()) - 1);
+            return dst;
+        }
+        
+        case NodeKind::Unary: {
+            int value = compileScalar(*node.children[0]);
+            if (node.unaryOp != UnaryOp::Negate) {
+                return value;
+            }
+            int dst = addRegister(ValueKind::Scalar, 1, 1);
+            emit(OpCode::ScalarNegate, dst, value);
+            return dst;
+        }
+        
+        case NodeKind::Transpose:
+            return compileScalar(*node.children[0]);
+        
+        case NodeKind::Binary: {
+            const AstNode& lhs = *node.children[0];
+            const AstNode& rhs = *node.children[1];
+            int dst = addRegister(ValueKind::Scalar, 1, 1);
+            
+            if (!lhs.isScalar() || !rhs.isScalar()) {
+                // Produit de deux opérandes non scalaires donnant un scalaire
+                if (lhs.type == ValueKind::Vector && rhs.type == ValueKind::Vector) {
+                    int a = operand(lhs);
+                    int b = operand(rhs);
+                    emit(OpCode::Dot, dst, a, b);
+                } else {
+                    accumulateProduct(lhs, rhs, {}, dst, true);
+                }
+                return dst;
+            }
+            
+            int a = compileScalar(lhs);
+            int b = compileScalar(rhs);
+            emit(OpCode::ScalarBinary, dst, a, b, {}, static_cast<int>(node.binaryOp));
+            return dst;
+        }
+        
+        case NodeKind::Call: {
+            const AstNode& argument = *node.children[0];
+            int dst = addRegister(ValueKind::Scalar, 1, 1);
+            if (argument.isScalar()) {
+                emit(OpCode::ScalarFunction, dst, compileScalar(argument), -1, {}, static_cast<int>(node.function));
+            } else {
+                emit(OpCode::Reduce, dst, operand(argument), -1, {}, static_cast<int>(node.function));
+            }
+            return dst;
+        }
+        
+        case NodeKind::Index: {
+            const AstNode& variable = *node.children[0];
+            int dst = addRegister(ValueKind::Scalar, 1, 1);
+            const Eigen::Index index = node.colRange.first * variable.rows + node.rowRange.first;
+            emit(OpCode::LoadElement, dst, operand(variable), -1, {}, addOffset(index));
+            return dst;
+        }
+        
+        case NodeKind::Literal:
+        case NodeKind::Range:
+            break;
+    }
+    throw std::runtime_error("Expression scalaire non supportée");
+}
+
+void BytecodeCompiler::compileInto(const AstNode& node, int dst) {
+    // Chaînes élément par élément : une seule passe sur la mémoire
+    if (shouldFuse(node)) {
+        FusedKernel kernel;
+        compileFused(node, kernel);
+        program_->kernels.push_back(std::move(kernel));
+        emit(OpCode::Fused, dst, -1, -1, {}, static_cast<int>(program_->kernels.size()) - 1);
+        return;
+    }
+    
+    switch (node.kind) {
+        case NodeKind::Variable:
+            emit(OpCode::Scale, dst, operand(node));
+            return;
+        
+        case NodeKind::Transpose:
+            emit(OpCode::Transpose, dst, operand(*node.children[0]));
+            return;
+        
+        case NodeKind::Literal: {
+            // Constantes copiées en bloc, puis éléments calculés un à un
+            if (node.children.size() < node.elements.size()) {
+                const double* data = node.elements.data();
+                if (node.type == ValueKind::Vector) {
+                    program_->literals.emplace_back(Eigen::Map<const Eigen::VectorXd>(data, node.rows));
+                } else {
+                    program_->literals.emplace_back(Eigen::Map<const RowMajorMatrix>(data, node.rows, node.cols));
+                }
+                emit(OpCode::LoadLiteral, dst, -1, -1, {}, static_cast<int>(program_->literals.size()) - 1);
+            }
+            
+            // Éléments lus ligne par ligne, stockage en ordre colonne
+            const Eigen::Index cols = node.type == ValueKind::Vector ? node.rows : node.cols;
+            for (size_t i = 0; i < node.children.size(); ++i) {
+                const Eigen::Index position = static_cast<Eigen::Index>(node.positions[i]);
+                const Eigen::Index row = position / cols;
+                const Eigen::Index col = position % cols;
+                const Eigen::Index index = node.type == ValueKind::Vector ? col : col * node.rows + row;
+                emit(OpCode::SetElement, dst, compileScalar(*node.children[i]), -1, {}, addOffset(index));
+            }
+            return;
+        }
+        
+        case NodeKind::Index:
+            program_->slices.push_back({node.rowRange, node.colRange, false});
+            emit(OpCode::Slice, dst, operand(*node.children[0]), -1, {}, static_cast<int>(program_->slices.size()) - 1);
+            return;
+        
+        case NodeKind::Unary:
+            break;
+        
+        case NodeKind::Binary: {
+            const AstNode& lhs = *node.children[0];
+            const AstNode& rhs = *node.children[1];
+            
+            switch (node.binaryOp) {
+                case BinaryOp::Mul:
+                    if (!lhs.isScalar() && !rhs.isScalar()) {
+                        accumulateProduct(lhs, rhs, {}, dst, true);
+                        return;
+                    }
+                    break;
+                
+                case BinaryOp::LeftDiv: {
+                    int a = operand(lhs);
+                    int b = operand(rhs);
+                    if (lhs.type == ValueKind::Sparse) {
+                        program_->solvers.emplace_back();
+                        emit(OpCode::SparseSolve, dst, a, b, {}, static_cast<int>(program_->solvers.size()) - 1);
+                    } else {
+                        emit(OpCode::Solve, dst, a, b);
+                    }
+                    return;
+                }
+                
+                case BinaryOp::Pow: {
+                    int a = operand(lhs);
+                    int exponent = compileScalar(rhs);
+                    emit(OpCode::MatrixPower, dst, a, exponent);
+                    return;
+                }
+                
+                default:
+                    break;
+            }
+            break;
+        }
+        
+        case NodeKind::Call:
+            if (node.function == FunctionId::Inv) {
+                emit(OpCode::Inverse, dst, operand(*node.children[0]));
+                return;
+            }
+            if (node.function == FunctionId::Full) {
+                const AstNode& argument = *node.children[0];
+                emit(argument.type == ValueKind::Sparse ? OpCode::SparseToDense : OpCode::Scale, dst, operand(argument));
+                return;
+            }
+            if (node.function == FunctionId::Cg || node.function == FunctionId::BiCgStab) {
+                SolverInfo solver;
+                solver.iterative = true;
+                solver.method = node.function == FunctionId::Cg ? IterativeMethod::ConjugateGradient
+                                                                : IterativeMethod::BiCgStab;
+                int a = operand(*node.children[0]);
+                int b = operand(*node.children[1]);
+                if (node.children.size() > 2) {
+                    solver.tolerance = compileScalar(*node.children[2]);
+                }
+                if (node.children.size() > 3) {
+                    solver.iterations = compileScalar(*node.children[3]);
+                }
+                program_->solvers.push_back(solver);
+                emit(OpCode::SparseSolve, dst, a, b, {}, static_cast<int>(program_->solvers.size()) - 1);
+                return;
+            }
+            throw std::runtime_error("Fonction non supportée : " + node.name);
+        
+        case NodeKind::Number:
+        case NodeKind::Fallback:
+        case NodeKind::Range:
+            throw std::runtime_error("Expression matricielle non supportée");
+    }
+    
+    // Sommes, opposés et produits par un scalaire : combinaison linéaire
+    std::vector<Term> terms;
+    collectTerms(node, {}, terms);
+    for (size_t i = 0; i < terms.size(); ++i) {
+        accumulateTerm(terms[i], dst, i == 0);
+    }
+}
+
+int BytecodeCompiler::compileSparse(const AstNode& node) {
+    switch (node.kind) {
+        case NodeKind::Variable:
+            return operand(node);
+        
+        case NodeKind::Transpose: {
+            int a = operand(*node.children[0]);
+            int dst = temporaryFor(node);
+            emit(OpCode::SparseScale, dst, a, -1, {}, Instruction::TRANSPOSE_LHS);
+            return dst;
+        }
+        
+        case NodeKind::Unary: {
+            int a = operand(*node.children[0]);
+            if (node.unaryOp != UnaryOp::Negate) {
+                return a;
+            }
+            int dst = temporaryFor(node);
+            emit(OpCode::SparseScale, dst, a, -1, {-1.0, -1});
+            return dst;
+        }
+        
+        case NodeKind::Binary: {
+            const AstNode& lhs = *node.children[0];
+            const AstNode& rhs = *node.children[1];
+            
+            // Produit ou quotient par un scalaire : la structure est conservée
+            if (lhs.isScalar() || rhs.isScalar()) {
+                const AstNode& matrix = lhs.isScalar() ? rhs : lhs;
+                const AstNode& factor = lhs.isScalar() ? lhs : rhs;
+                Coefficient coef = node.binaryOp == BinaryOp::Div ? divide({}, factor) : multiply({}, factor);
+                int a = operand(matrix);
+                int dst = temporaryFor(node);
+                emit(OpCode::SparseScale, dst, a, -1, coef);
+                return dst;
+            }
+            
+            int a = operand(lhs);
+            int b = operand(rhs);
+            int dst = temporaryFor(node);
+            emit(OpCode::SparseBinary, dst, a, b, {}, static_cast<int>(node.binaryOp));
+            return dst;
+        }
+        
+        case NodeKind::Call: {
+            // sparse(A), sparse(m, n) ou sparse(i, j, v, m, n)
+            const AstNode& first = *node.children[0];
+            if (node.children.size() == 1 && first.type == ValueKind::Sparse) {
+                return operand(first);
+            }
+            int dst = temporaryFor(node);
+            if (node.children.size() == 1) {
+                emit(OpCode::SparseFromDense, dst, operand(first));
+            } else if (node.children.size() == 2) {
+                emit(OpCode::SparseFromTriplets, dst);
+            } else {
+                int rows = operand(first);
+                int cols = operand(*node.children[1]);
+                int values = operand(*node.children[2]);
+                emit(OpCode::SparseFromTriplets, dst, rows, cols, {}, values);
+            }
+            return dst;
+        }
+        
+        default:
+            break;
+    }
+    throw std::runtime_error("Expression creuse non supportée");
+}
+
+int BytecodeCompiler::operand(const AstNode& node) {
+    if (node.kind == NodeKind::Variable && node.value) {
+        // Registre lié aux données de la variable, partagé par toutes ses lectures
+        const int index = guards_.at(node.name);
+        VariableGuard& guard = program_->variables[index];
+        if (guard.reg < 0) {
+            guard.reg = addRegister(guard.type, guard.rows, guard.cols, RegisterStorage::Variable);
+            program_->registers[guard.reg].variable = index;
+        }
+        return guard.reg;
+    }
+    
+    if (node.isScalar()) {
+        return compileScalar(node);
+    }
+    if (node.type == ValueKind::Sparse) {
+        return compileSparse(node);
+    }
+    
+    // Opérande composite : matérialisé une seule fois dans un temporaire
+    int reg = temporaryFor(node);
+    compileInto(node, reg);
+    return reg;
+}
+
+BytecodeCompiler::Coefficient BytecodeCompiler::multiply(Coefficient coef, const AstNode& factor) {
+    if (factor.kind == NodeKind::Number) {
+        coef.constant *= factor.number;
+        return coef;
+    }
+    
+    int value = compileScalar(factor);
+    if (coef.scale < 0) {
+        coef.scale = value;
+        return coef;
+    }
+    int product = addRegister(ValueKind::Scalar, 1, 1);
+    emit(OpCode::ScalarBinary, product, coef.scale, value, {}, static_cast<int>(BinaryOp::Mul));
+    coef.scale = product;
+    return coef;
+}
+
+BytecodeCompiler::Coefficient BytecodeCompiler::divide(Coefficient coef, const AstNode& divisor) {
+    if (divisor.kind == NodeKind::Number) {
+        coef.constant /= divisor.number;
+        return coef;
+    }
+    
+    int value = compileScalar(divisor);
+    int numerator = coef.scale;
+    if (numerator < 0) {
+        numerator = addRegister(ValueKind::Scalar, 1, 1);
+        emit(OpCode::LoadConstant, numerator, -1, -1, {coef.constant, -1});
+        coef.constant = 1.0;
+    }
+    int quotient = addRegister(ValueKind::Scalar, 1, 1);
+    emit(OpCode::ScalarBinary, quotient, numerator, value, {}, static_cast<int>(BinaryOp::Div));
+    coef.scale = quotient;
+    return coef;
+}
+
+void BytecodeCompiler::collectTerms(const AstNode& node, Coefficient coef, std::vector<Term>& terms) {
+    if (node.kind == NodeKind::Unary) {
+        if (node.unaryOp == UnaryOp::Negate) {
+            coef.constant = -coef.constant;
+        }
+        collectTerms(*node.children[0], coef, terms);
+        return;
+    }
+    
+    if (node.kind == NodeKind::Binary && !node.isScalar()) {
+        const AstNode& lhs = *node.children[0];
+        const AstNode& rhs = *node.children[1];
+        
+        switch (node.binaryOp) {
+            case BinaryOp::Add:
+                collectTerms(lhs, coef, terms);
+                collectTerms(rhs, coef, terms);
+                return;
+            
+            case BinaryOp::Sub: {
+                collectTerms(lhs, coef, terms);
+                Coefficient negated = coef;
+                negated.constant = -negated.constant;
+                collectTerms(rhs, negated, terms);
+                return;
+            }
+            
+            case BinaryOp::Mul:
+            case BinaryOp::ElemMul:
+                if (lhs.isScalar()) {
+                    collectTerms(rhs, multiply(coef, lhs), terms);
+                    return;
+                }
+                if (rhs.isScalar()) {
+                    collectTerms(lhs, multiply(coef, rhs), terms);
+                    return;
+                }
+                break;
+            
+            case BinaryOp::Div:
+            case BinaryOp::ElemDiv:
+                if (rhs.isScalar() && !lhs.isScalar()) {
+                    collectTerms(lhs, divide(coef, rhs), terms);
+                    return;
+                }
+                break;
+            
+            default:
+                break;
+        }
+    }
+    
+    terms.push_back({coef, &node});
+}
+
+void BytecodeCompiler::accumulateTerm(const Term& term, int dst, bool assign) {
+    const AstNode& node = *term.node;
+    
+    // Scalaire diffusé sur tous les éléments
+    if (node.isScalar()) {
+        emit(assign ? OpCode::Fill : OpCode::AddConstant, dst, -1, -1, multiply(term.coef, node));
+        return;
+    }
+    
+    // Matrice creuse : seuls ses éléments non nuls sont ajoutés
+    if (node.type == ValueKind::Sparse) {
+        if (assign) {
+            emit(OpCode::Fill, dst, -1, -1, {0.0, -1});
+        }
+        emit(OpCode::SparseAddTo, dst, operand(node), -1, term.coef);
+        return;
+    }
+    
+    // Variable ou transposée de variable : expression paresseuse sans copie
+    if (node.kind == NodeKind::Variable) {
+        emit(assign ? OpCode::Scale : OpCode::AddScaled, dst, operand(node), -1, term.coef);
+        return;
+    }
+    if (node.kind == NodeKind::Transpose && node.children[0]->kind == NodeKind::Variable) {
+        emit(assign ? OpCode::Scale : OpCode::AddScaled, dst, operand(*node.children[0]), -1, term.coef,
+             Instruction::TRANSPOSE_LHS);
+        return;
+    }
+    
+    // Produit matriciel : GEMM accumulé directement dans la destination
+    if (node.kind == NodeKind::Binary && node.binaryOp == BinaryOp::Mul) {
+        accumulateProduct(*node.children[0], *node.children[1], term.coef, dst, assign);
+        return;
+    }
+    
+    if (assign) {
+        compileInto(node, dst);
+        if (!term.coef.isOne()) {
+            emit(OpCode::ScaleInPlace, dst, -1, -1, term.coef);
+        }
+        return;
+    }
+    emit(OpCode::AddScaled, dst, operand(node), -1, term.coef);
+}
+
+void BytecodeCompiler::accumulateProduct(const AstNode& lhs, const AstNode& rhs, Coefficient coef, int dst, bool assign) {
+    // Les transposées sont absorbées par le GEMM
+    bool lhsTransposed = lhs.kind == NodeKind::Transpose && !lhs.children[0]->isScalar();
+    bool rhsTransposed = rhs.kind == NodeKind::Transpose && !rhs.children[0]->isScalar();
+    int a = operand(lhsTransposed ? *lhs.children[0] : lhs);
+    int b = operand(rhsTransposed ? *rhs.children[0] : rhs);
+    
+    int flags = 0;
+    if (lhsTransposed) {
+        flags |= Instruction::TRANSPOSE_LHS;
+    }
+    if (rhsTransposed) {
+        flags |= Instruction::TRANSPOSE_RHS;
+    }
+    if (!assign) {
+        flags |= Instruction::ACCUMULATE;
+    }
+    const bool sparse = program_->registers[a].type == ValueKind::Sparse ||
+                        program_->registers[b].type == ValueKind::Sparse;
+    emit(sparse ? OpCode::SparseProduct : OpCode::Gemm, dst, a, b, coef, flags);
+}
+
+bool BytecodeCompiler::isFusible(const AstNode& node) const {
+    if (node.isScalar()) {
+        return false;
+    }
+    for (const auto& child : node.children) {
+        if (child->type == ValueKind::Sparse) {
+            return false;
+        }
+    }
+    
+    switch (node.kind) {
+        case NodeKind::Unary:
+            return true;
+        
+        case NodeKind::Call:
+            return ElementwiseProgram::supports(node.function);
+        
+        case NodeKind::Binary:
+            switch (node.binaryOp) {
+                case BinaryOp::Add:
+                case BinaryOp::Sub:
+                case BinaryOp::ElemMul:
+                case BinaryOp::ElemDiv:
+                case BinaryOp::ElemPow:
+                    return true;
+                case BinaryOp::Mul:
+                case BinaryOp::Div:
+                    return node.children[0]->isScalar() || node.children[1]->isScalar();
+                case BinaryOp::Pow:
+                case BinaryOp::LeftDiv:
+                    return false;
+            }
+            return false;
+        
+        default:
+            return false;
+    }
+}
+
+void BytecodeCompiler::analyzeFusion(const AstNode& node, FusionStats& stats) const {
+    if (node.isScalar()) {
+        return;
+    }
+    
+    if (!isFusible(node)) {
+        // Feuille : une variable est lue en place, le reste doit être matérialisé
+        if (node.kind != NodeKind::Variable) {
+            ++stats.opaqueLeaves;
+        }
+        return;
+    }
+    
+    if (node.kind == NodeKind::Call) {
+        ++stats.nonlinearOps;
+    } else if (node.kind == NodeKind::Binary) {
+        bool lhsScalar = node.children[0]->isScalar();
+        bool rhsScalar = node.children[1]->isScalar();
+        switch (node.binaryOp) {
+            case BinaryOp::ElemPow:
+                ++stats.nonlinearOps;
+                break;
+            case BinaryOp::ElemMul:
+                if (!lhsScalar && !rhsScalar) {
+                    ++stats.nonlinearOps;
+                }
+                break;
+            case BinaryOp::ElemDiv:
+                if (!rhsScalar) {
+                    ++stats.nonlinearOps;
+                }
+                break;
+            default:
+                break;
+        }
+    }
+    
+    for (const auto& child : node.children) {
+        analyzeFusion(*child, stats);
+    }
+}
+
+bool BytecodeCompiler::shouldFuse(const AstNode& node) const {
+    if (!isFusible(node)) {
+        return false;
+    }
+    
+    // Une combinaison linéaire de produits/transposées reste plus efficace
+    // accumulée par GEMM dans la destination que matérialisée terme à terme
+    FusionStats stats;
+    analyzeFusion(node, stats);
+    return stats.nonlinearOps > 0 || stats.opaqueLeaves == 0;
+}
+
+int BytecodeCompiler::compileFused(const AstNode& node, FusedKernel& kernel) {
+    if (!isFusible(node)) {
+        kernel.inputs.push_back(operand(node));
+        return kernel.program.addInput();
+    }
+    
+    // Les sous-arbres scalaires sont calculés une fois, avant la boucle
+    auto bindScalar = [&](int reg) {
+        kernel.scalars.push_back(reg);
+        return kernel.program.addScalar();
+    };
+    
+    switch (node.kind) {
+        case NodeKind::Unary: {
+            int x = compileFused(*node.children[0], kernel);
+            if (node.unaryOp != UnaryOp::Negate) {
+                return x;
+            }
+            int minusOne = addRegister(ValueKind::Scalar, 1, 1);
+            emit(OpCode::LoadConstant, minusOne, -1, -1, {-1.0, -1});
+            return kernel.program.emitScalar(BinaryOp::Mul, x, bindScalar(minusOne), false);
+        }
+        
+        case NodeKind::Call:
+            return kernel.program.emitUnary(node.function, compileFused(*node.children[0], kernel));
+        
+        default: {
+            const AstNode& lhs = *node.children[0];
+            const AstNode& rhs = *node.children[1];
+            
+            if (lhs.isScalar()) {
+                int s = bindScalar(compileScalar(lhs));
+                return kernel.program.emitScalar(node.binaryOp, compileFused(rhs, kernel), s, true);
+            }
+            if (rhs.isScalar()) {
+                int s = bindScalar(compileScalar(rhs));
+                return kernel.program.emitScalar(node.binaryOp, compileFused(lhs, kernel), s, false);
+            }
+            int x = compileFused(lhs, kernel);
+            int y = compileFused(rhs, kernel);
+            return kernel.program.emitBinary(node.binaryOp, x, y);
+        }
+    }
+}
+
+} // namespace FusioCore
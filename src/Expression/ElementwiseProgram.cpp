@@ -0,0 +1,229 @@
+#include "Expression/ElementwiseProgram.hpp"
+#include "Math/VectorMath.hpp"
+#include "Runtime/ThreadPool.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace FusioCore {
+
+namespace {
+
+using ArrayIn = Eigen::Map<const Eigen::ArrayXd>;
+using ArrayOut = Eigen::Map<Eigen::ArrayXd>;
+
+// Noyaux unaires
+void kernelSin(const double* x, double* out, Eigen::Index n) { VectorMath::sin(x, out, static_cast<size_t>(n)); }
+void kernelCos(const double* x, double* out, Eigen::Index n) { VectorMath::cos(x, out, static_cast<size_t>(n)); }
+void kernelTan(const double* x, double* out, Eigen::Index n) { VectorMath::tan(x, out, static_cast<size_t>(n)); }
+void kernelExp(const double* x, double* out, Eigen::Index n) { VectorMath::exp(x, out, static_cast<size_t>(n)); }
+void kernelLog(const double* x, double* out, Eigen::Index n) { VectorMath::log(x, out, static_cast<size_t>(n)); }
+void kernelLog10(const double* x, double* out, Eigen::Index n) { VectorMath::log10(x, out, static_cast<size_t>(n)); }
+void kernelSqrt(const double* x, double* out, Eigen::Index n) { VectorMath::sqrt(x, out, static_cast<size_t>(n)); }
+void kernelAbs(const double* x, double* out, Eigen::Index n) { ArrayOut(out, n) = ArrayIn(x, n).abs(); }
+
+// Conversions : valeurs arrondies au type cible, conservées en double dans les registres
+void kernelSingle(const double* x, double* out, Eigen::Index n) {
+    ArrayOut(out, n) = ArrayIn(x, n).cast<float>().cast<double>();
+}
+void kernelDouble(const double* x, double* out, Eigen::Index n) { ArrayOut(out, n) = ArrayIn(x, n); }
+template <typename T>
+void kernelInteger(const double* x, double* out, Eigen::Index n) {
+    ArrayOut(out, n) = ArrayIn(x, n).unaryExpr([](double value) { return static_cast<double>(narrow<T>(value)); });
+}
+
+// Noyaux binaires
+void kernelAdd(const double* x, const double* y, double* out, Eigen::Index n) { ArrayOut(out, n) = ArrayIn(x, n) + ArrayIn(y, n); }
+void kernelSub(const double* x, const double* y, double* out, Eigen::Index n) { ArrayOut(out, n) = ArrayIn(x, n) - ArrayIn(y, n); }
+void kernelMul(const double* x, const double* y, double* out, Eigen::Index n) { ArrayOut(out, n) = ArrayIn(x, n) * ArrayIn(y, n); }
+void kernelDiv(const double* x, const double* y, double* out, Eigen::Index n) { ArrayOut(out, n) = ArrayIn(x, n) / ArrayIn(y, n); }
+void kernelPow(const double* x, const double* y, double* out, Eigen::Index n) {
+    ArrayOut(out, n) = ArrayIn(x, n).binaryExpr(ArrayIn(y, n), [](double a, double b) { return std::pow(a, b); });
+}
+
+// Noyaux avec scalaire diffusé
+void kernelAddScalar(const double* x, double s, double* out, Eigen::Index n) { ArrayOut(out, n) = ArrayIn(x, n) + s; }
+void kernelSubScalar(const double* x, double s, double* out, Eigen::Index n) { ArrayOut(out, n) = ArrayIn(x, n) - s; }
+void kernelScalarSub(const double* x, double s, double* out, Eigen::Index n) { ArrayOut(out, n) = s - ArrayIn(x, n); }
+void kernelMulScalar(const double* x, double s, double* out, Eigen::Index n) { ArrayOut(out, n) = ArrayIn(x, n) * s; }
+void kernelDivScalar(const double* x, double s, double* out, Eigen::Index n) { ArrayOut(out, n) = ArrayIn(x, n) / s; }
+void kernelScalarDiv(const double* x, double s, double* out, Eigen::Index n) { ArrayOut(out, n) = s / ArrayIn(x, n); }
+void kernelPowScalar(const double* x, double s, double* out, Eigen::Index n) {
+    if (s == 2.0) {
+        ArrayOut(out, n) = ArrayIn(x, n).square();
+        return;
+    }
+    ArrayOut(out, n) = ArrayIn(x, n).unaryExpr([s](double a) { return std::pow(a, s); });
+}
+void kernelScalarPow(const double* x, double s, double* out, Eigen::Index n) {
+    ArrayOut(out, n) = ArrayIn(x, n).unaryExpr([s](double b) { return std::pow(s, b); });
+}
+
+ElementwiseProgram::UnaryKernel selectUnary(FunctionId function) {
+    switch (function) {
+        case FunctionId::Sin: return kernelSin;
+        case FunctionId::Cos: return kernelCos;
+        case FunctionId::Tan: return kernelTan;
+        case FunctionId::Exp: return kernelExp;
+        case FunctionId::Log: return kernelLog;
+        case FunctionId::Log10: return kernelLog10;
+        case FunctionId::Sqrt: return kernelSqrt;
+        case FunctionId::Abs: return kernelAbs;
+        case FunctionId::Single: return kernelSingle;
+        case FunctionId::Double: return kernelDouble;
+        case FunctionId::Int32: return kernelInteger<int32_t>;
+        case FunctionId::Int64: return kernelInteger<int64_t>;
+        default: return nullptr;
+    }
+}
+
+ElementwiseProgram::BinaryKernel selectBinary(BinaryOp op) {
+    switch (op) {
+        case BinaryOp::Add: return kernelAdd;
+        case BinaryOp::Sub: return kernelSub;
+        case BinaryOp::ElemMul: return kernelMul;
+        case BinaryOp::ElemDiv: return kernelDiv;
+        case BinaryOp::ElemPow: return kernelPow;
+        default: return nullptr;
+    }
+}
+
+ElementwiseProgram::ScalarKernel selectScalar(BinaryOp op, bool scalarOnLeft) {
+    switch (op) {
+        case BinaryOp::Add: return kernelAddScalar;
+        case BinaryOp::Sub: return scalarOnLeft ? kernelScalarSub : kernelSubScalar;
+        case BinaryOp::Mul:
+        case BinaryOp::ElemMul: return kernelMulScalar;
+        case BinaryOp::Div:
+        case BinaryOp::ElemDiv: return scalarOnLeft ? kernelScalarDiv : kernelDivScalar;
+        case BinaryOp::Pow:
+        case BinaryOp::ElemPow:
+            return scalarOnLeft ? kernelScalarPow : kernelPowScalar;
+        case BinaryOp::LeftDiv:
+            // s \ x est réécrit en x / s au typage
+            break;
+    }
+    return nullptr;
+}
+
+} // namespace
+
+int ElementwiseProgram::addInput() {
+    Register reg;
+    reg.input = inputCount_++;
+    registers_.push_back(reg);
+    return static_cast<int>(registers_.size()) - 1;
+}
+
+int ElementwiseProgram::addScalar() {
+    return scalarCount_++;
+}
+
+int ElementwiseProgram::emitUnary(FunctionId function, int x) {
+    Instruction instruction;
+    instruction.unary = selectUnary(function);
+    if (!instruction.unary) {
+        throw std::runtime_error("Fonction élément par élément non supportée");
+    }
+    instruction.x = x;
+    instruction.out = allocateTemporary(x, -1);
+    instructions_.push_back(instruction);
+    return instruction.out;
+}
+
+int ElementwiseProgram::emitBinary(BinaryOp op, int x, int y) {
+    Instruction instruction;
+    instruction.binary = selectBinary(op);
+    if (!instruction.binary) {
+        throw std::runtime_error("Opérateur élément par élément non supporté");
+    }
+    instruction.x = x;
+    instruction.y = y;
+    instruction.out = allocateTemporary(x, y);
+    instructions_.push_back(instruction);
+    return instruction.out;
+}
+
+int ElementwiseProgram::emitScalar(BinaryOp op, int x, int scalar, bool scalarOnLeft) {
+    Instruction instruction;
+    instruction.scalar = selectScalar(op, scalarOnLeft);
+    instruction.x = x;
+    instruction.scalarIndex = scalar;
+    instruction.out = allocateTemporary(x, -1);
+    instructions_.push_back(instruction);
+    return instruction.out;
+}
+
+bool ElementwiseProgram::supports(FunctionId function) {
+    return selectUnary(function) != nullptr;
+}
+
+int ElementwiseProgram::allocateTemporary(int x, int y) {
+    // Chaque temporaire n'est lu qu'une fois : son tampon est réutilisable
+    for (int operand : {x, y}) {
+        if (operand >= 0 && registers_[operand].input < 0) {
+            freeSlots_.push_back(registers_[operand].slot);
+        }
+    }
+    
+    Register reg;
+    if (!freeSlots_.empty()) {
+        reg.slot = freeSlots_.back();
+        freeSlots_.pop_back();
+    } else {
+        reg.slot = slotCount_++;
+    }
+    registers_.push_back(reg);
+    return static_cast<int>(registers_.size()) - 1;
+}
+
+void ElementwiseProgram::run(const double* const* inputs, const double* scalars, double* out, Eigen::Index n) const {
+    if (instructions_.empty()) {
+        if (!registers_.empty() && registers_.back().input >= 0) {
+            const double* input = inputs[registers_.back().input];
+            std::copy(input, input + n, out);
+        }
+        return;
+    }
+    
+    // Grands tableaux : blocs de tuiles répartis sur le pool de threads
+    if (n >= ThreadPool::PARALLEL_THRESHOLD) {
+        ThreadPool::getInstance().parallelFor(n, PARALLEL_GRAIN, [&](Eigen::Index begin, Eigen::Index end) {
+            runRange(inputs, scalars, out, begin, end);
+        });
+    } else {
+        runRange(inputs, scalars, out, 0, n);
+    }
+}
+
+void ElementwiseProgram::runRange(const double* const* inputs, const double* scalars, double* out,
+                                  Eigen::Index begin, Eigen::Index end) const {
+    std::vector<double> tiles(static_cast<size_t>(slotCount_) * TILE_SIZE);
+    const int resultRegister = instructions_.back().out;
+    
+    for (Eigen::Index offset = begin; offset < end; offset += TILE_SIZE) {
+        const Eigen::Index length = std::min(TILE_SIZE, end - offset);
+        
+        auto source = [&](int index) -> const double* {
+            const Register& reg = registers_[index];
+            return reg.input >= 0 ? inputs[reg.input] + offset : tiles.data() + reg.slot * TILE_SIZE;
+        };
+        
+        for (const Instruction& instruction : instructions_) {
+            // Le dernier résultat est écrit directement dans la destination
+            double* target = instruction.out == resultRegister
+                           ? out + offset
+                           : tiles.data() + registers_[instruction.out].slot * TILE_SIZE;
+            
+            if (instruction.unary) {
+                instruction.unary(source(instruction.x), target, length);
+            } else if (instruction.binary) {
+                instruction.binary(source(instruction.x), source(instruction.y), target, length);
+            } else {
+                instruction.scalar(source(instruction.x), scalars[instruction.scalarIndex], target, length);
+            }
+        }
+    }
+}
+
+} // namespace FusioCore
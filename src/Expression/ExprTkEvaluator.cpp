@@ -1,42 +1,68 @@
 #include "Expression/ExprTkEvaluator.hpp"
-#include "Value/Scalar.hpp"
-#include "Value/Vector.hpp"
-#include "Value/Matrix.hpp"
+#include "Expression/BatchProgram.hpp"
+#include "Runtime/ThreadPool.hpp"
 #include <stdexcept>
 #include <cmath>
+#include <type_traits>
 
 namespace FusioCore {
 
-ExprTkEvaluator::ExprTkEvaluator() {
+namespace {
+
+// Formule ExprTk d'un bloc de l'évaluation par lots, liée à ses propres emplacements de colonnes
+struct BatchRows {
+    exprtk::symbol_table<double> symbols;
+    exprtk::expression<double> expression;
+    std::vector<double> slots;
+};
+
+// Compile la formule pour un bloc : les colonnes masquent les variables de même nom
+bool compileBatchRows(const std::string& expression, const std::vector<BatchColumn>& columns,
+                      std::map<std::string, double>& environment, BatchRows& rows) {
+    rows.slots.assign(columns.size(), 0.0);
+    for (size_t i = 0; i < columns.size(); ++i) {
+        rows.symbols.add_variable(columns[i].name, rows.slots[i]);
+    }
+    // Variables de l'environnement liées en lecture seule : partagées par les blocs
+    for (auto& [name, slot] : environment) {
+        rows.symbols.add_variable(name, slot);
+    }
+    rows.symbols.add_constants();
+    rows.expression.register_symbol_table(rows.symbols);
+    
+    exprtk::parser<double> parser;
+    return parser.compile(expression, rows.expression);
+}
+
+} // namespace
+
+ExprTkEvaluator::ExprTkEvaluator(size_t cacheCapacity)
+    : cacheCapacity_(cacheCapacity)
+{
     // Initialisation des symboles ExprTk
     symbolTable_.add_constants();
-    expression_.register_symbol_table(symbolTable_);
 }
 
 ExprTkEvaluator::~ExprTkEvaluator() = default;
 
-std::shared_ptr<IValue> ExprTkEvaluator::evaluate(const std::string& expression) {
+Value ExprTkEvaluator::evaluate(const std::string& expression) {
     // Vérifier si c'est une variable
     auto it = variables_.find(expression);
     if (it != variables_.end()) {
-        return it->second;
+        return it->second.copy();
     }
     
-    // Vérifier si l'expression est valide
-    if (!isValid(expression)) {
+    // Compiler l'expression (ou la reprendre depuis le cache)
+    auto* compiled = compile(expression);
+    if (!compiled) {
         throw std::runtime_error("Expression invalide: " + expression);
     }
     
-    // Compiler l'expression
-    if (!parser_.compile(expression, expression_)) {
-        throw std::runtime_error("Erreur de compilation: " + parser_.error());
-    }
-    
-    // Évaluer l'expression
-    double result = expression_.value();
+    // Évaluer l'expression, avec les normes des vecteurs et matrices à jour
+    updateArrayVariables();
     
-    // Convertir le résultat en IValue
-    return doubleToValue(result);
+    // Résultat scalaire, stocké dans la valeur sans allocation
+    return Scalar(compiled->value());
 }
 
 bool ExprTkEvaluator::isValid(const std::string& expression) {
@@ -44,79 +70,193 @@ bool ExprTkEvaluator::isValid(const std::string& expression) {
     if (variables_.find(expression) != variables_.end()) {
         return true;
     }
-    return parser_.compile(expression, expression_);
+    return compile(expression) != nullptr;
+}
+
+Vector ExprTkEvaluator::evaluateBatch(const std::string& expression, const std::vector<BatchColumn>& columns) {
+    const Eigen::Index rows = BatchProgram::rowCount(columns);
+    
+    std::vector<std::string> names;
+    names.reserve(columns.size());
+    for (const BatchColumn& column : columns) {
+        names.push_back(column.name);
+    }
+    if (auto program = BatchProgram::compile(expression, names, *this)) {
+        return Vector(program->run(columns));
+    }
+    
+    // Hors grammaire native : ExprTk, ligne par ligne. Une formule invalide
+    // est signalée avant de répartir les blocs.
+    updateArrayVariables();
+    {
+        BatchRows probe;
+        if (!compileBatchRows(expression, columns, exprTkVariables_, probe)) {
+            throw std::runtime_error("Expression invalide: " + expression);
+        }
+    }
+    
+    Eigen::VectorXd result(rows);
+    ThreadPool::getInstance().parallelFor(rows, BATCH_BLOCK, [&](Eigen::Index begin, Eigen::Index end) {
+        BatchRows block;
+        if (!compileBatchRows(expression, columns, exprTkVariables_, block)) {
+            throw std::runtime_error("Expression invalide: " + expression);
+        }
+        for (Eigen::Index i = begin; i < end; ++i) {
+            for (size_t k = 0; k < columns.size(); ++k) {
+                block.slots[k] = columns[k].values[i];
+            }
+            result[i] = block.expression.value();
+        }
+    });
+    return Vector(std::move(result));
 }
 
-void ExprTkEvaluator::setVariable(const std::string& name, const std::shared_ptr<IValue>& value) {
-    // Stocker la variable
-    variables_[name] = value;
+void ExprTkEvaluator::setVariable(const std::string& name, Value value) {
+    // Convertir en double pour ExprTk ; la norme d'un vecteur ou d'une matrice
+    // (O(n) à O(n²)) n'est calculée qu'à la prochaine évaluation par ExprTk
+    const bool isArray = value && !value.isScalar();
+    double scalarValue = isArray ? 0.0 : valueToDouble(value);
     
-    // Convertir en double pour ExprTk
-    exprTkVariables_[name] = valueToDouble(value);
+    // Stocker la variable (affectation en place : un pointeur obtenu par getVariable reste valide)
+    variables_[name] = std::move(value);
+    if (isArray) {
+        staleVariables_.insert(name);
+    } else {
+        staleVariables_.erase(name);
+    }
+    
+    // Variable déjà liée : écrire la valeur en place, les expressions compilées restent valides
+    auto it = exprTkVariables_.find(name);
+    if (it != exprTkVariables_.end()) {
+        it->second = scalarValue;
+        return;
+    }
     
-    // Mettre à jour les variables dans ExprTk
-    updateExprTkVariables();
+    // Nouvelle variable : lier une seule fois son emplacement stable à ExprTk
+    auto& slot = exprTkVariables_.emplace(name, scalarValue).first->second;
+    symbolTable_.add_variable(name, slot);
 }
 
-std::shared_ptr<IValue> ExprTkEvaluator::getVariable(const std::string& name) {
+Value* ExprTkEvaluator::getVariable(const std::string& name) {
     auto it = variables_.find(name);
     if (it != variables_.end()) {
-        return it->second;
+        return &it->second;
     }
     return nullptr;
 }
 
 void ExprTkEvaluator::removeVariable(const std::string& name) {
     variables_.erase(name);
-    exprTkVariables_.erase(name);
-    updateExprTkVariables();
+    staleVariables_.erase(name);
+    
+    auto it = exprTkVariables_.find(name);
+    if (it == exprTkVariables_.end()) {
+        return;
+    }
+    
+    // Les expressions compilées peuvent référencer le symbole supprimé
+    symbolTable_.remove_variable(name);
+    exprTkVariables_.erase(it);
+    dropCompiledExpressions();
 }
 
 void ExprTkEvaluator::clearVariables() {
     variables_.clear();
+    staleVariables_.clear();
+    
+    // Réinitialiser la table de symboles
+    symbolTable_.clear();
+    symbolTable_.add_constants();
     exprTkVariables_.clear();
-    updateExprTkVariables();
+    dropCompiledExpressions();
+}
+
+double ExprTkEvaluator::valueToDouble(const Value& value) const {
+    return value.visit([](const auto& alternative) {
+        using T = std::decay_t<decltype(alternative)>;
+        if constexpr (std::is_same_v<T, Scalar>) {
+            return alternative.getValue();
+        } else if constexpr (std::is_same_v<T, Vector> || std::is_same_v<T, Matrix>) {
+            return alternative.getData().norm(); // Retourne la norme du vecteur ou de la matrice
+        } else if constexpr (std::is_same_v<T, SparseMatrix>) {
+            return alternative.getData().norm(); // Norme calculée sur les seuls éléments non nuls
+        } else {
+            return 0.0;
+        }
+    });
 }
 
-double ExprTkEvaluator::valueToDouble(const std::shared_ptr<IValue>& value) const {
-    if (!value) {
-        return 0.0;
+void ExprTkEvaluator::updateArrayVariables() {
+    for (const std::string& name : staleVariables_) {
+        exprTkVariables_[name] = valueToDouble(variables_[name]);
     }
-    
-    if (value->isScalar()) {
-        auto scalar = std::dynamic_pointer_cast<Scalar>(value);
-        return scalar->getValue();
+    staleVariables_.clear();
+}
+
+void ExprTkEvaluator::dropCompiledExpressions() {
+    cacheEntries_.clear();
+    cacheIndex_.clear();
+    uncachedExpression_.release();
+}
+
+exprtk::expression<double>* ExprTkEvaluator::compile(const std::string& expression) {
+    if (cacheCapacity_ == 0) {
+        // Cache désactivé : compiler dans l'expression de travail
+        ++cacheMisses_;
+        uncachedExpression_ = exprtk::expression<double>();
+        uncachedExpression_.register_symbol_table(symbolTable_);
+        return parser_.compile(expression, uncachedExpression_) ? &uncachedExpression_ : nullptr;
     }
     
-    if (value->isVector()) {
-        auto vector = std::dynamic_pointer_cast<Vector>(value);
-        return vector->getData().norm(); // Retourne la norme du vecteur
+    auto it = cacheIndex_.find(expression);
+    if (it != cacheIndex_.end()) {
+        // Remonter l'entrée en tête de la liste LRU
+        cacheEntries_.splice(cacheEntries_.begin(), cacheEntries_, it->second);
+        ++cacheHits_;
+        return &it->second->second;
     }
     
-    if (value->isMatrix()) {
-        auto matrix = std::dynamic_pointer_cast<Matrix>(value);
-        return matrix->getData().norm(); // Retourne la norme de la matrice
+    ++cacheMisses_;
+    
+    // Compiler directement dans un nouveau nœud pour éviter toute copie
+    cacheEntries_.emplace_front(expression, exprtk::expression<double>());
+    auto& entry = cacheEntries_.front();
+    entry.second.register_symbol_table(symbolTable_);
+    if (!parser_.compile(expression, entry.second)) {
+        cacheEntries_.pop_front();
+        return nullptr;
     }
     
-    return 0.0;
+    cacheIndex_.emplace(entry.first, cacheEntries_.begin());
+    evictOverflow();
+    return &entry.second;
 }
 
-std::shared_ptr<IValue> ExprTkEvaluator::doubleToValue(double value) const {
-    return std::make_shared<Scalar>(value);
+void ExprTkEvaluator::evictOverflow() {
+    while (cacheEntries_.size() > cacheCapacity_) {
+        cacheIndex_.erase(cacheEntries_.back().first);
+        cacheEntries_.pop_back();
+    }
 }
 
-void ExprTkEvaluator::updateExprTkVariables() {
-    // Réinitialiser la table de symboles
-    symbolTable_.clear();
-    symbolTable_.add_constants();
-    
-    // Ajouter les variables
-    for (const auto& pair : exprTkVariables_) {
-        symbolTable_.add_variable(pair.first, exprTkVariables_[pair.first]);
-    }
-    
-    // Réinitialiser l'expression
-    expression_.register_symbol_table(symbolTable_);
+ExprTkEvaluator::CacheStats ExprTkEvaluator::getCacheStats() const {
+    CacheStats stats;
+    stats.hits = cacheHits_;
+    stats.misses = cacheMisses_;
+    stats.size = cacheIndex_.size();
+    stats.capacity = cacheCapacity_;
+    return stats;
+}
+
+void ExprTkEvaluator::setCacheCapacity(size_t capacity) {
+    cacheCapacity_ = capacity;
+    evictOverflow();
+}
+
+void ExprTkEvaluator::clearCache() {
+    dropCompiledExpressions();
+    cacheHits_ = 0;
+    cacheMisses_ = 0;
 }
 
 } // namespace FusioCore 
\ No newline at end of file
@@ -1,24 +1,70 @@
 #include "Expression/ExpressionEvaluatorFactory.hpp"
 #include "Expression/ExprTkEvaluator.hpp"
+#include "Expression/NativeEvaluator.hpp"
+#include <atomic>
+#include <cstdlib>
 #include <stdexcept>
 
 namespace FusioCore {
 
+namespace {
+
+std::atomic<EvaluatorType>& defaultType() {
+    static std::atomic<EvaluatorType> type = [] {
+        if (const char* requested = std::getenv("FUSIO_EVALUATOR")) {
+            try {
+                return ExpressionEvaluatorFactory::typeFromName(requested);
+            } catch (const std::runtime_error&) {
+                // Nom inconnu : moteur par défaut
+            }
+        }
+        return EvaluatorType::EXPRTK;
+    }();
+    return type;
+}
+
+} // namespace
+
 std::shared_ptr<IExpressionEvaluator> ExpressionEvaluatorFactory::createEvaluator(EvaluatorType type) {
     switch (type) {
         case EvaluatorType::EXPRTK:
             return std::make_shared<ExprTkEvaluator>();
+        case EvaluatorType::NATIVE:
+            return std::make_shared<NativeEvaluator>();
         default:
             throw std::runtime_error("Type d'évaluateur non supporté");
     }
 }
 
 std::shared_ptr<IExpressionEvaluator> ExpressionEvaluatorFactory::createEvaluator(const std::string& name) {
+    return createEvaluator(typeFromName(name));
+}
+
+EvaluatorType ExpressionEvaluatorFactory::typeFromName(const std::string& name) {
     if (name == "exprtk") {
-        return createEvaluator(EvaluatorType::EXPRTK);
+        return EvaluatorType::EXPRTK;
+    }
+    if (name == "native") {
+        return EvaluatorType::NATIVE;
     }
     
     throw std::runtime_error("Évaluateur inconnu: " + name);
 }
 
-} // namespace FusioCore 
\ No newline at end of file
+const char* ExpressionEvaluatorFactory::typeName(EvaluatorType type) {
+    switch (type) {
+        case EvaluatorType::EXPRTK: return "exprtk";
+        case EvaluatorType::NATIVE: return "native";
+    }
+    return "?";
+}
+
+EvaluatorType ExpressionEvaluatorFactory::getDefaultType() {
+    return defaultType().load();
+}
+
+void ExpressionEvaluatorFactory::setDefaultType(EvaluatorType type) {
+    defaultType().store(type);
+}
+
+} // namespace FusioCore 
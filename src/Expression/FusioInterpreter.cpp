@@ -1,154 +1,140 @@
 #include "Expression/FusioInterpreter.hpp"
-#include "Value/Value.hpp"
-#include <sstream>
+#include "IO/CsvReader.hpp"
+#include "IO/MatrixFile.hpp"
+#include "Value/Variant.hpp"
+#include "Value/Warnings.hpp"
 #include <algorithm>
+#include <cctype>
+#include <filesystem>
 #include <stdexcept>
 
 namespace FusioCore {
 
+namespace {
+
+bool isBlank(char c) {
+    return std::isspace(static_cast<unsigned char>(c)) != 0;
+}
+
+// Retire les espaces en tête et en fin
+std::string_view trim(std::string_view text) {
+    while (!text.empty() && isBlank(text.front())) {
+        text.remove_prefix(1);
+    }
+    while (!text.empty() && isBlank(text.back())) {
+        text.remove_suffix(1);
+    }
+    return text;
+}
+
+// Lit un identifiant en tête de text et l'en retire
+std::string_view takeIdentifier(std::string_view& text) {
+    size_t end = 0;
+    if (text.empty() || !std::isalpha(static_cast<unsigned char>(text.front()))) {
+        return {};
+    }
+    while (end < text.size() && (std::isalnum(static_cast<unsigned char>(text[end])) || text[end] == '_')) {
+        ++end;
+    }
+    std::string_view identifier = text.substr(0, end);
+    text = trim(text.substr(end));
+    return identifier;
+}
+
+} // namespace
+
 FusioInterpreter::FusioInterpreter()
-    : evaluator_(std::make_unique<ExprTkEvaluator>())
-    , assignmentRegex_("^\\s*([a-zA-Z][a-zA-Z0-9_]*)\\s*=\\s*(.+)\\s*$")
-    , vectorRegex_("^\\s*\\[(.+)\\]\\s*$")
-    , matrixRegex_("^\\s*\\[(.+)\\]\\s*$")
-    , scalarMatrixOpRegex_("^\\s*([0-9.]+)\\s*\\*\\s*([a-zA-Z][a-zA-Z0-9_]*)\\s*$")
-    , matrixScalarOpRegex_("^\\s*([a-zA-Z][a-zA-Z0-9_]*)\\s*\\*\\s*([0-9.]+)\\s*$")
+    : FusioInterpreter(std::make_shared<ProgramCache>())
+{
+}
+
+FusioInterpreter::FusioInterpreter(std::shared_ptr<ProgramCache> programs, EvaluatorType type)
+    : evaluatorType_(type)
+    , evaluator_(ExpressionEvaluatorFactory::createEvaluator(type))
+    , compiler_(std::make_unique<BytecodeCompiler>(*evaluator_))
+    , machine_(std::make_unique<VirtualMachine>(*evaluator_))
+    , programs_(std::move(programs))
 {
 }
 
 FusioInterpreter::~FusioInterpreter() = default;
 
-std::shared_ptr<IValue> FusioInterpreter::evaluate(const std::string& input) {
-    // Vérifier si c'est une variable
-    auto value = evaluator_->getVariable(input);
-    if (value) {
-        return value;
-    }
+EvaluatorType FusioInterpreter::getEvaluatorType() const {
+    return evaluatorType_;
+}
+
+Value FusioInterpreter::evaluate(const std::string& input) {
+    // Seuls les avertissements de cette évaluation restent à récupérer
+    Warnings::take();
     
-    // Si l'entrée est un identifiant valide (lettre suivie de lettres/chiffres), c'est une variable non définie
-    if (std::regex_match(input, std::regex("^[a-zA-Z][a-zA-Z0-9_]*$"))) {
-        throw std::runtime_error("Variable non définie : " + input);
+    // Les chaînes n'apparaissent que dans save/load/readcsv
+    if (input.find('"') != std::string::npos) {
+        return evaluateFileStatement(input);
     }
     
-    // Vérifier si c'est une fonction mathématique sur une matrice
-    std::regex funcMatrixRegex("^(sin|cos|tan|exp|log|log10|sqrt)\\s*\\(([a-zA-Z][a-zA-Z0-9_]*)\\)$");
-    std::smatch funcMatrixMatch;
-    if (std::regex_match(input, funcMatrixMatch, funcMatrixRegex)) {
-        std::string funcName = funcMatrixMatch[1].str();
-        std::string matrixName = funcMatrixMatch[2].str();
-        
-        auto matrixValue = evaluator_->getVariable(matrixName);
-        if (matrixValue && matrixValue->isMatrix()) {
-            auto matrix = std::dynamic_pointer_cast<Matrix>(matrixValue);
-            Eigen::MatrixXd result = matrix->getData();
-            
-            // Appliquer la fonction élément par élément
-            for(int i = 0; i < result.rows(); ++i) {
-                for(int j = 0; j < result.cols(); ++j) {
-                    if(funcName == "sin") result(i,j) = std::sin(result(i,j));
-                    else if(funcName == "cos") result(i,j) = std::cos(result(i,j));
-                    else if(funcName == "tan") result(i,j) = std::tan(result(i,j));
-                    else if(funcName == "exp") result(i,j) = std::exp(result(i,j));
-                    else if(funcName == "log") result(i,j) = std::log(result(i,j));
-                    else if(funcName == "log10") result(i,j) = std::log10(result(i,j));
-                    else if(funcName == "sqrt") result(i,j) = std::sqrt(result(i,j));
-                }
-            }
-            return std::make_shared<Matrix>(result);
+    if (evaluatorType_ == EvaluatorType::NATIVE) {
+        if (Value result = evaluateNative(input)) {
+            return result;
         }
     }
     
-    // Vérifier si c'est une opération scalaire * matrice
-    std::smatch scalarMatrixMatch;
-    if (std::regex_match(input, scalarMatrixMatch, scalarMatrixOpRegex_)) {
-        double scalarValue = std::stod(scalarMatrixMatch[1].str());
-        std::string matrixName = scalarMatrixMatch[2].str();
-        
-        auto matrixValue = evaluator_->getVariable(matrixName);
-        if (matrixValue && matrixValue->isMatrix()) {
-            auto matrix = std::dynamic_pointer_cast<Matrix>(matrixValue);
-            return std::make_shared<Matrix>(matrix->getData() * scalarValue);
-        }
+    CompiledStatement& statement = lookup(input);
+    Value result = machine_->execute(*statement.program, statement.frame);
+    if (result) {
+        return result;
     }
     
-    // Vérifier si c'est une opération matrice * scalaire
-    std::smatch matrixScalarMatch;
-    if (std::regex_match(input, matrixScalarMatch, matrixScalarOpRegex_)) {
-        std::string matrixName = matrixScalarMatch[1].str();
-        double scalarValue = std::stod(matrixScalarMatch[2].str());
-        
-        auto matrixValue = evaluator_->getVariable(matrixName);
-        if (matrixValue && matrixValue->isMatrix()) {
-            auto matrix = std::dynamic_pointer_cast<Matrix>(matrixValue);
-            return std::make_shared<Matrix>(matrix->getData() * scalarValue);
+    // Une variable lue a changé de type ou de dimensions : reprendre une
+    // spécialisation compilée par une autre session, sinon respécialiser.
+    // Une garde refusée interrompt l'exécution avant tout calcul.
+    for (auto& program : programs_->find(input, evaluatorType_)) {
+        if (program == statement.program) {
+            continue;
+        }
+        VirtualMachine::Frame frame;
+        result = machine_->execute(*program, frame);
+        if (result) {
+            statement.program = std::move(program);
+            statement.frame = std::move(frame);
+            return result;
         }
     }
     
-    // Vérifier si c'est une assignation
-    if (isAssignment(input)) {
-        return processAssignment(input);
-    }
-    
-    // Vérifier si c'est une création de matrice (doit être vérifié avant le vecteur)
-    if (isMatrixCreation(input)) {
-        return processMatrixCreation(input);
-    }
-    
-    // Vérifier si c'est une création de vecteur
-    if (isVectorCreation(input)) {
-        return processVectorCreation(input);
+    statement.program = compile(input);
+    statement.frame = VirtualMachine::Frame();
+    result = machine_->execute(*statement.program, statement.frame);
+    if (!result) {
+        throw std::runtime_error("Instruction non exécutable : " + input);
     }
-    
-    // Sinon, évaluer comme une expression normale
-    return evaluator_->evaluate(input);
+    return result;
 }
 
 bool FusioInterpreter::isValid(const std::string& input) {
-    // Vérifier si c'est une assignation valide
-    if (isAssignment(input)) {
-        auto [varName, expr] = parseAssignment(input);
-        return evaluator_->isValid(expr);
-    }
-    
-    // Vérifier si c'est une création de vecteur valide
-    if (isVectorCreation(input)) {
-        try {
-            auto elements = parseVectorElements(input);
-            for (const auto& element : elements) {
-                if (!evaluator_->isValid(element)) {
-                    return false;
-                }
-            }
+    if (evaluatorType_ == EvaluatorType::NATIVE) {
+        std::string target;
+        std::string expression = input;
+        BytecodeCompiler::splitAssignment(input, target, expression);
+        if (evaluator_->isValid(expression)) {
             return true;
-        } catch (...) {
-            return false;
         }
     }
-    
-    // Vérifier si c'est une création de matrice valide
-    if (isMatrixCreation(input)) {
-        try {
-            auto elements = parseVectorElements(input);
-            for (const auto& element : elements) {
-                if (!evaluator_->isValid(element)) {
-                    return false;
-                }
-            }
-            return true;
-        } catch (...) {
-            return false;
-        }
+    try {
+        compiler_->compile(input);
+        return true;
+    } catch (const std::exception&) {
+        return false;
     }
-    
-    // Sinon, vérifier comme une expression normale
-    return evaluator_->isValid(input);
 }
 
-void FusioInterpreter::setVariable(const std::string& name, const std::shared_ptr<IValue>& value) {
-    evaluator_->setVariable(name, value);
+Vector FusioInterpreter::evaluateBatch(const std::string& expression, const std::vector<BatchColumn>& columns) {
+    return evaluator_->evaluateBatch(expression, columns);
 }
 
-std::shared_ptr<IValue> FusioInterpreter::getVariable(const std::string& name) {
+void FusioInterpreter::setVariable(const std::string& name, Value value) {
+    evaluator_->setVariable(name, std::move(value));
+}
+
+const Value* FusioInterpreter::getVariable(const std::string& name) {
     return evaluator_->getVariable(name);
 }
 
@@ -160,315 +146,149 @@ void FusioInterpreter::clearVariables() {
     evaluator_->clearVariables();
 }
 
-std::vector<std::pair<std::string, std::shared_ptr<IValue>>> FusioInterpreter::listVariables() const {
+std::vector<std::pair<std::string, Value>> FusioInterpreter::listVariables() const {
     // Cette méthode nécessiterait une extension de l'interface ExprTkEvaluator
     // pour exposer les variables internes. Pour l'instant, retournons un vecteur vide.
     return {};
 }
 
-std::shared_ptr<IValue> FusioInterpreter::processAssignment(const std::string& input) {
-    auto [varName, expr] = parseAssignment(input);
+Value FusioInterpreter::evaluateNative(const std::string& input) {
+    std::string target;
+    std::string expression = input;
+    BytecodeCompiler::splitAssignment(input, target, expression);
     
-    // Vérifier si l'expression est une création de matrice ou de vecteur
-    if (isMatrixCreation(expr)) {
-        auto result = processMatrixCreation(expr);
-        evaluator_->setVariable(varName, result);
-        return result;
+    // Expression compilée une fois par l'évaluateur (cache), relue ensuite par evaluate
+    if (!evaluator_->isValid(expression)) {
+        return Value();
     }
-    
-    if (isVectorCreation(expr)) {
-        auto result = processVectorCreation(expr);
-        evaluator_->setVariable(varName, result);
-        return result;
+    Value result = evaluator_->evaluate(expression);
+    if (!target.empty()) {
+        evaluator_->setVariable(target, result.copy());
     }
-    
-    // Sinon, évaluer comme une expression normale
-    auto result = evaluator_->evaluate(expr);
-    evaluator_->setVariable(varName, result);
     return result;
 }
 
-std::shared_ptr<IValue> FusioInterpreter::processVectorCreation(const std::string& input) {
-    auto elements = parseVectorElements(input);
+Value FusioInterpreter::evaluateFileStatement(const std::string& input) {
+    std::string_view rest = trim(input);
     
-    // Évaluer chaque élément
-    std::vector<double> values;
-    for (const auto& element : elements) {
-        auto result = evaluator_->evaluate(element);
-        if (result->isScalar()) {
-            values.push_back(std::dynamic_pointer_cast<Scalar>(result)->getValue());
-        } else {
-            throw std::runtime_error("Les éléments d'un vecteur doivent être des scalaires");
-        }
+    // Cible facultative : "nom = load(...)", "nom = readcsv(...)"
+    std::string target;
+    std::string_view afterTarget = rest;
+    std::string_view name = takeIdentifier(afterTarget);
+    if (!name.empty() && afterTarget.size() > 1 && afterTarget[0] == '=' && afterTarget[1] != '=') {
+        target = std::string(name);
+        rest = trim(afterTarget.substr(1));
     }
     
-    // Créer le vecteur
-    Eigen::VectorXd vectorData(values.size());
-    for (size_t i = 0; i < values.size(); ++i) {
-        vectorData(i) = values[i];
+    std::string_view function = takeIdentifier(rest);
+    const bool known = function == "save" || function == "load" || function == "readcsv";
+    if (!known || rest.size() < 2 || rest.front() != '(' || rest.back() != ')') {
+        throw std::runtime_error("Chaîne de caractères inattendue : " + input);
     }
+    std::string_view arguments = trim(rest.substr(1, rest.size() - 2));
     
-    return std::make_shared<Vector>(vectorData);
-}
-
-std::shared_ptr<IValue> FusioInterpreter::processMatrixCreation(const std::string& input) {
-    // Extraire le contenu entre les crochets
-    std::smatch match;
-    if (!std::regex_match(input, match, matrixRegex_)) {
-        throw std::runtime_error("Format de matrice invalide");
+    // Le chemin est la dernière chaîne des arguments
+    size_t open = arguments.size() >= 2 && arguments.back() == '"' ? arguments.rfind('"', arguments.size() - 2)
+                                                                    : std::string_view::npos;
+    if (open == std::string_view::npos) {
+        throw std::runtime_error("Chemin de fichier attendu entre guillemets : " + input);
     }
+    const std::string path = resolvePath(std::string(arguments.substr(open + 1, arguments.size() - open - 2)));
+    std::string_view leading = trim(arguments.substr(0, open));
     
-    std::string content = match[1].str();
-    
-    // Diviser le contenu en lignes
-    std::vector<std::string> rows;
-    std::string currentRow;
-    
-    for (size_t i = 0; i < content.length(); ++i) {
-        char c = content[i];
-        
-        if (c == ';') {
-            if (!currentRow.empty()) {
-                rows.push_back(currentRow);
-                currentRow.clear();
-            }
-        } else {
-            currentRow += c;
+    if (function != "save") {
+        if (!leading.empty()) {
+            throw std::runtime_error("Syntaxe attendue : " + std::string(function) + "(\"fichier\")");
         }
-    }
-    
-    // Ajouter la dernière ligne
-    if (!currentRow.empty()) {
-        rows.push_back(currentRow);
-    }
-    
-    if (rows.empty()) {
-        throw std::runtime_error("Matrice vide");
-    }
-    
-    // Déterminer les dimensions
-    size_t numRows = rows.size();
-    size_t numCols = 0;
-    
-    // Compter les colonnes dans la première ligne
-    std::string firstRow = rows[0];
-    std::string currentElement;
-    
-    for (size_t i = 0; i < firstRow.length(); ++i) {
-        char c = firstRow[i];
-        
-        if (c == ' ' || c == ',') {
-            if (!currentElement.empty()) {
-                numCols++;
-                currentElement.clear();
-            }
+        Value value;
+        if (function == "load") {
+            value = MatrixFile::load(path);
         } else {
-            currentElement += c;
+            value = CsvReader::read(path, lastImport_);
         }
-    }
-    
-    // Ajouter le dernier élément de la première ligne
-    if (!currentElement.empty()) {
-        numCols++;
-    }
-    
-    if (numCols == 0) {
-        throw std::runtime_error("Matrice invalide : aucune colonne détectée");
-    }
-    
-    // Extraire tous les éléments
-    std::vector<double> values;
-    
-    for (const auto& row : rows) {
-        std::string currentElement;
-        
-        for (size_t i = 0; i < row.length(); ++i) {
-            char c = row[i];
-            
-            if (c == ' ' || c == ',') {
-                if (!currentElement.empty()) {
-                    auto result = evaluator_->evaluate(currentElement);
-                    if (result->isScalar()) {
-                        values.push_back(std::dynamic_pointer_cast<Scalar>(result)->getValue());
-                    } else {
-                        throw std::runtime_error("Les éléments d'une matrice doivent être des scalaires");
-                    }
-                    currentElement.clear();
-                }
-            } else {
-                currentElement += c;
-            }
+        if (!target.empty()) {
+            setVariable(target, value.copy());
         }
-        
-        // Ajouter le dernier élément de la ligne
-        if (!currentElement.empty()) {
-            auto result = evaluator_->evaluate(currentElement);
-            if (result->isScalar()) {
-                values.push_back(std::dynamic_pointer_cast<Scalar>(result)->getValue());
-            } else {
-                throw std::runtime_error("Les éléments d'une matrice doivent être des scalaires");
-            }
-        }
-    }
-    
-    // Vérifier que le nombre d'éléments correspond aux dimensions
-    if (values.size() != numRows * numCols) {
-        throw std::runtime_error("Le nombre d'éléments (" + std::to_string(values.size()) + 
-                                ") ne correspond pas aux dimensions de la matrice (" + 
-                                std::to_string(numRows) + "x" + std::to_string(numCols) + ")");
+        return value;
     }
     
-    // Créer la matrice
-    Eigen::MatrixXd matrixData(numRows, numCols);
-    for (size_t i = 0; i < numRows; ++i) {
-        for (size_t j = 0; j < numCols; ++j) {
-            matrixData(i, j) = values[i * numCols + j];
-        }
+    if (!target.empty() || leading.size() < 2 || leading.back() != ',') {
+        throw std::runtime_error("Syntaxe attendue : save(expression, \"fichier\")");
     }
-    
-    return std::make_shared<Matrix>(matrixData);
+    Value value = evaluate(std::string(trim(leading.substr(0, leading.size() - 1))));
+    MatrixFile::save(path, value);
+    return value;
 }
 
-bool FusioInterpreter::isAssignment(const std::string& input) const {
-    std::smatch match;
-    return std::regex_match(input, match, assignmentRegex_);
+const CsvStats& FusioInterpreter::getLastImport() const {
+    return lastImport_;
 }
 
-bool FusioInterpreter::isVectorCreation(const std::string& input) const {
-    std::smatch match;
-    if (!std::regex_match(input, match, vectorRegex_)) {
-        return false;
+void FusioInterpreter::restrictFiles(const std::string& root) {
+    std::string canonical;
+    if (!root.empty()) {
+        std::error_code error;
+        canonical = std::filesystem::canonical(root, error).string();
+        if (error || !std::filesystem::is_directory(canonical)) {
+            throw std::runtime_error("Répertoire des fichiers invalide : " + root);
+        }
     }
-    
-    // Vérifier que ce n'est pas une matrice
-    std::string content = match[1].str();
-    return content.find(';') == std::string::npos;
+    filesRestricted_ = true;
+    fileRoot_ = std::move(canonical);
 }
 
-bool FusioInterpreter::isMatrixCreation(const std::string& input) const {
-    std::smatch match;
-    if (!std::regex_match(input, match, matrixRegex_)) {
-        return false;
-    }
-    
-    // Vérifier si le contenu contient au moins un point-virgule
-    std::string content = match[1].str();
-    return content.find(';') != std::string::npos;
+std::string FusioInterpreter::resolvePath(const std::string& path) const {
+    if (!filesRestricted_) {
+        return path;
+    }
+    if (fileRoot_.empty()) {
+        throw std::runtime_error("Instructions de fichier désactivées dans cette session");
+    }
+    
+    // Liens symboliques et ".." résolus avant la vérification
+    namespace fs = std::filesystem;
+    const fs::path root(fileRoot_);
+    const fs::path requested(path);
+    std::error_code error;
+    const fs::path resolved = fs::weakly_canonical(requested.is_absolute() ? requested : root / requested, error);
+    const bool inside = !error && std::mismatch(root.begin(), root.end(), resolved.begin(), resolved.end()).first ==
+                                      root.end();
+    if (!inside) {
+        throw std::runtime_error("Chemin hors du répertoire autorisé : " + path);
+    }
+    return resolved.string();
 }
 
-std::pair<std::string, std::string> FusioInterpreter::parseAssignment(const std::string& input) const {
-    std::smatch match;
-    if (std::regex_match(input, match, assignmentRegex_)) {
-        return {match[1].str(), match[2].str()};
-    }
-    throw std::runtime_error("Format d'assignation invalide");
+FusioInterpreter::CompiledStatement& FusioInterpreter::lookup(const std::string& input) {
+    auto it = statementIndex_.find(input);
+    if (it != statementIndex_.end()) {
+        // Remonter l'entrée en tête de la liste LRU
+        statements_.splice(statements_.begin(), statements_, it->second);
+        return *it->second;
+    }
+    
+    // Programme compilé par une session (la spécialisation la plus récente),
+    // sinon compilé avant d'insérer : une instruction invalide n'est pas conservée
+    auto programs = programs_->find(input, evaluatorType_);
+    auto program = programs.empty() ? compile(input) : std::move(programs.front());
+    statements_.emplace_front();
+    CompiledStatement& statement = statements_.front();
+    statement.text = input;
+    statement.program = std::move(program);
+    statementIndex_.emplace(statement.text, statements_.begin());
+    
+    // Évincer les entrées les moins récemment utilisées
+    while (statements_.size() > STATEMENT_CACHE_CAPACITY) {
+        statementIndex_.erase(statements_.back().text);
+        statements_.pop_back();
+    }
+    return statement;
 }
 
-std::vector<std::string> FusioInterpreter::parseVectorElements(const std::string& input) const {
-    std::vector<std::string> elements;
-    
-    // Extraire le contenu entre les crochets
-    std::smatch match;
-    if (!std::regex_match(input, match, vectorRegex_)) {
-        throw std::runtime_error("Format de vecteur invalide");
-    }
-    
-    std::string content = match[1].str();
-    
-    // Analyser le contenu pour extraire les éléments
-    std::string currentElement;
-    bool inQuotes = false;
-    int parenthesesCount = 0;
-    
-    for (size_t i = 0; i < content.length(); ++i) {
-        char c = content[i];
-        
-        if (c == '\'' && !inQuotes) {
-            inQuotes = true;
-            currentElement += c;
-        } else if (c == '\'' && inQuotes) {
-            inQuotes = false;
-            currentElement += c;
-        } else if (c == '(' && !inQuotes) {
-            parenthesesCount++;
-            currentElement += c;
-        } else if (c == ')' && !inQuotes) {
-            parenthesesCount--;
-            currentElement += c;
-        } else if ((c == ' ' || c == ';' || c == ',') && !inQuotes && parenthesesCount == 0) {
-            // Fin d'un élément si on n'est pas déjà dans un espace
-            if (!currentElement.empty() && currentElement.back() != ' ') {
-                // Supprimer les espaces en début et fin
-                currentElement = std::regex_replace(currentElement, std::regex("^\\s+|\\s+$"), "");
-                if (!currentElement.empty()) {
-                    elements.push_back(currentElement);
-                }
-                currentElement.clear();
-            }
-        } else {
-            currentElement += c;
-        }
-    }
-    
-    // Ajouter le dernier élément s'il existe
-    if (!currentElement.empty()) {
-        currentElement = std::regex_replace(currentElement, std::regex("^\\s+|\\s+$"), "");
-        if (!currentElement.empty()) {
-            elements.push_back(currentElement);
-        }
-    }
-    
-    return elements;
-}
-
-std::pair<size_t, size_t> FusioInterpreter::parseMatrixDimensions(const std::string& input) const {
-    // Extraire le contenu entre les crochets
-    std::smatch match;
-    if (!std::regex_match(input, match, matrixRegex_)) {
-        throw std::runtime_error("Format de matrice invalide");
-    }
-    
-    std::string content = match[1].str();
-    
-    // Compter le nombre de points-virgules pour déterminer le nombre de lignes
-    size_t rows = 1;
-    for (char c : content) {
-        if (c == ';') {
-            rows++;
-        }
-    }
-    
-    // Compter le nombre d'éléments dans la première ligne
-    size_t cols = 0;
-    bool inFirstRow = true;
-    std::string currentElement;
-    
-    for (size_t i = 0; i < content.length(); ++i) {
-        char c = content[i];
-        
-        if (c == ';') {
-            inFirstRow = false;
-            currentElement.clear();
-        } else if ((c == ' ' || c == ',') && inFirstRow) {
-            if (!currentElement.empty()) {
-                cols++;
-                currentElement.clear();
-            }
-        } else if (inFirstRow) {
-            currentElement += c;
-        }
-    }
-    
-    // Ajouter le dernier élément de la première ligne
-    if (!currentElement.empty() && inFirstRow) {
-        cols++;
-    }
-    
-    if (cols == 0) {
-        throw std::runtime_error("Matrice invalide : aucune colonne détectée");
-    }
-    
-    return {rows, cols};
+std::shared_ptr<const Program> FusioInterpreter::compile(const std::string& input) {
+    auto program = compiler_->compile(input);
+    programs_->publish(input, evaluatorType_, program);
+    return program;
 }
 
-} // namespace FusioCore 
\ No newline at end of file
+} // namespace FusioCore
@@ -0,0 +1,140 @@
+#include "Expression/Lexer.hpp"
+#include <cctype>
+#include <charconv>
+#include <cstdlib>
+#include <utility>
+
+namespace FusioCore {
+
+namespace {
+
+bool isIdentifierStart(char c) {
+    return std::isalpha(static_cast<unsigned char>(c)) || c == '_';
+}
+
+bool isIdentifierChar(char c) {
+    return std::isalnum(static_cast<unsigned char>(c)) || c == '_';
+}
+
+bool isDigit(char c) {
+    return std::isdigit(static_cast<unsigned char>(c)) != 0;
+}
+
+// Une apostrophe est une transposée si elle suit un opérande
+bool endsOperand(TokenType previous) {
+    switch (previous) {
+        case TokenType::Number:
+        case TokenType::Identifier:
+        case TokenType::RParen:
+        case TokenType::RBracket:
+        case TokenType::Apostrophe:
+            return true;
+        default:
+            return false;
+    }
+}
+
+} // namespace
+
+Lexer::Lexer(const std::string& source) : source_(source) {}
+
+std::vector<Token> Lexer::tokenize(const std::string& source) {
+    Lexer lexer(source);
+    std::vector<Token> tokens;
+    do {
+        tokens.push_back(lexer.next());
+    } while (tokens.back().type != TokenType::End);
+    return tokens;
+}
+
+Token Lexer::next() {
+    const size_t length = source_.length();
+    bool space = false;
+    
+    while (position_ < length && std::isspace(static_cast<unsigned char>(source_[position_]))) {
+        space = true;
+        ++position_;
+    }
+    
+    Token token;
+    token.position = position_;
+    token.spaceBefore = space;
+    
+    auto emit = [&](TokenType type, size_t consumed) {
+        token.type = type;
+        token.text = source_.substr(position_, consumed);
+        previous_ = type;
+        position_ += consumed;
+        return std::move(token);
+    };
+    
+    if (position_ == length) {
+        token.type = TokenType::End;
+        return token;
+    }
+    char c = source_[position_];
+    
+    // Nombres : entier, décimal, notation scientifique
+    if (isDigit(c) || (c == '.' && position_ + 1 < length && isDigit(source_[position_ + 1]))) {
+        const char* begin = source_.data() + position_;
+        auto [end, error] = std::from_chars(begin, source_.data() + length, token.number);
+        if (error == std::errc::result_out_of_range) {
+            // Dépassement (1e400) ou sous-dépassement : même arrondi que strtod
+            token.number = std::strtod(begin, nullptr);
+        }
+        size_t consumed = static_cast<size_t>(end - begin);
+        
+        // "2./A" : le point appartient à l'opérateur élément par élément
+        if (consumed > 1 && begin[consumed - 1] == '.' && position_ + consumed < length) {
+            char next = source_[position_ + consumed];
+            if (next == '*' || next == '/' || next == '^') {
+                --consumed;
+            }
+        }
+        return emit(TokenType::Number, consumed);
+    }
+    
+    if (isIdentifierStart(c)) {
+        size_t end = position_;
+        while (end < length && isIdentifierChar(source_[end])) {
+            ++end;
+        }
+        return emit(TokenType::Identifier, end - position_);
+    }
+    
+    // Opérateurs élément par élément
+    if (c == '.' && position_ + 1 < length) {
+        char next = source_[position_ + 1];
+        if (next == '*' || next == '/' || next == '^') {
+            TokenType type = next == '*' ? TokenType::DotStar
+                           : next == '/' ? TokenType::DotSlash
+                           : TokenType::DotCaret;
+            return emit(type, 2);
+        }
+    }
+    
+    switch (c) {
+        case '+': return emit(TokenType::Plus, 1);
+        case '-': return emit(TokenType::Minus, 1);
+        case '*': return emit(TokenType::Star, 1);
+        case '/': return emit(TokenType::Slash, 1);
+        case '\\': return emit(TokenType::Backslash, 1);
+        case '^': return emit(TokenType::Caret, 1);
+        case '(': return emit(TokenType::LParen, 1);
+        case ')': return emit(TokenType::RParen, 1);
+        case ',': return emit(TokenType::Comma, 1);
+        case ';': return emit(TokenType::Semicolon, 1);
+        case ':': return emit(TokenType::Colon, 1);
+        case '[': return emit(TokenType::LBracket, 1);
+        case ']': return emit(TokenType::RBracket, 1);
+        case '\'':
+            if (!endsOperand(previous_)) {
+                throw SyntaxError("Chaîne de caractères non supportée à la position " + std::to_string(position_));
+            }
+            return emit(TokenType::Apostrophe, 1);
+        default:
+            throw SyntaxError(std::string("Caractère inattendu '") + c + "' à la position " + std::to_string(position_));
+    }
+}
+
+} // namespace FusioCore
@@ -0,0 +1,734 @@
+#include "Expression/NativeEvaluator.hpp"
+#include "Expression/BatchProgram.hpp"
+#include "Expression/BytecodeCompiler.hpp"
+#include "Expression/Parser.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+namespace FusioCore {
+
+namespace {
+
+// Applique f à chaque élément d'un scalaire, d'un vecteur ou d'une matrice dense
+template <typename F>
+Value mapElements(const Value& value, F f, const char* operation) {
+    switch (value.kind()) {
+        case ValueKind::Scalar:
+            return Scalar(f(value.toDouble()));
+        case ValueKind::Vector:
+            return Vector(Eigen::VectorXd(value.as<Vector>().getData().unaryExpr(f)));
+        case ValueKind::Matrix:
+            return Matrix(Eigen::MatrixXd(value.as<Matrix>().getData().unaryExpr(f)));
+        case ValueKind::Sparse:
+            break;
+    }
+    throw std::runtime_error(std::string(operation) + " non supporté pour une matrice creuse (utiliser full)");
+}
+
+// Opération élément par élément : un scalaire est diffusé, deux tableaux ont les mêmes dimensions
+template <typename F>
+Value combineElements(const Value& lhs, const Value& rhs, F f, const char* symbol) {
+    if (lhs.isScalar()) {
+        const double a = lhs.toDouble();
+        return mapElements(rhs, [&](double b) { return f(a, b); }, symbol);
+    }
+    if (rhs.isScalar()) {
+        const double b = rhs.toDouble();
+        return mapElements(lhs, [&](double a) { return f(a, b); }, symbol);
+    }
+    
+    if (lhs.isVector() && rhs.isVector()) {
+        Eigen::Ref<const Eigen::VectorXd> a = lhs.as<Vector>().getData();
+        Eigen::Ref<const Eigen::VectorXd> b = rhs.as<Vector>().getData();
+        if (a.size() == b.size()) {
+            return Vector(Eigen::VectorXd(a.binaryExpr(b, f)));
+        }
+    } else if (lhs.isMatrix() && rhs.isMatrix()) {
+        Eigen::Ref<const Eigen::MatrixXd> a = lhs.as<Matrix>().getData();
+        Eigen::Ref<const Eigen::MatrixXd> b = rhs.as<Matrix>().getData();
+        if (a.rows() == b.rows() && a.cols() == b.cols()) {
+            return Matrix(Eigen::MatrixXd(a.binaryExpr(b, f)));
+        }
+    }
+    throw std::runtime_error(std::string("Opération ") + symbol + " non définie entre " + lhs.typeName() +
+                             " et " + rhs.typeName() + " de ces dimensions");
+}
+
+Value divideValues(const Value& lhs, const Value& rhs) {
+    if (rhs.isScalar() && !lhs.isSparse()) {
+        return combineElements(lhs, rhs, [](double a, double b) { return a / b; }, "/");
+    }
+    if (rhs.isScalar()) {
+        return lhs * Value(1.0 / rhs.toDouble());
+    }
+    return lhs / rhs;
+}
+
+// A \ b : résolution pour une matrice, division pour un scalaire
+Value solveValues(const Value& lhs, const Value& rhs) {
+    if (lhs.isScalar()) {
+        return divideValues(rhs, lhs);
+    }
+    if (lhs.isMatrix() && rhs.isVector()) {
+        return lhs.as<Matrix>().solve(rhs.as<Vector>());
+    }
+    if (lhs.isMatrix() && rhs.isMatrix()) {
+        return lhs.as<Matrix>().solve(rhs.as<Matrix>());
+    }
+    if (lhs.isSparse() && rhs.isVector()) {
+        return Vector(Eigen::VectorXd(lhs.as<SparseMatrix>().solve(rhs.as<Vector>().getData()).col(0)));
+    }
+    if (lhs.isSparse() && rhs.isMatrix()) {
+        return Matrix(lhs.as<SparseMatrix>().solve(rhs.as<Matrix>().getData()));
+    }
+    throw std::runtime_error(std::string("Opération \\ non définie entre ") + lhs.typeName() + " et " +
+                             rhs.typeName());
+}
+
+// A ^ n : puissance d'un scalaire, ou d'une matrice carrée par un entier
+// (A ^ -k : puissance de l'inverse, obtenu depuis la décomposition LU conservée par A)
+Value powerValues(const Value& lhs, const Value& rhs) {
+    if (lhs.isScalar() && rhs.isScalar()) {
+        return Scalar(std::pow(lhs.toDouble(), rhs.toDouble()));
+    }
+    if (!lhs.isMatrix() || !rhs.isScalar()) {
+        throw std::runtime_error(std::string("Opération ^ non définie entre ") + lhs.typeName() + " et " +
+                                 rhs.typeName() + " (utiliser .^)");
+    }
+    
+    const Matrix& matrix = lhs.as<Matrix>();
+    const double exponent = rhs.toDouble();
+    if (matrix.rows() != matrix.cols() || exponent != std::floor(exponent)) {
+        throw std::runtime_error("Puissance matricielle : matrice carrée et exposant entier attendus");
+    }
+    
+    // Exponentiation rapide : log2(|n|) produits
+    Eigen::MatrixXd square = exponent < 0 ? Eigen::MatrixXd(matrix.inverse().getData())
+                                          : Eigen::MatrixXd(matrix.getData());
+    Eigen::MatrixXd result = Eigen::MatrixXd::Identity(square.rows(), square.cols());
+    for (auto n = static_cast<unsigned long long>(std::abs(exponent)); n > 0; n >>= 1) {
+        if (n & 1) {
+            result = result * square;
+        }
+        if (n > 1) {
+            square = square * square;
+        }
+    }
+    return Matrix(std::move(result));
+}
+
+// Indices, colonnes ou valeurs de sparse(i, j, v, m, n) : un vecteur, ou un scalaire répété
+Eigen::VectorXd tripletArgument(const Value& value) {
+    if (value.isScalar()) {
+        return Eigen::VectorXd::Constant(1, value.toDouble());
+    }
+    if (value.isVector()) {
+        return value.as<Vector>().getData();
+    }
+    throw std::runtime_error("Les triplets de sparse(i, j, v, m, n) doivent être des vecteurs ou des scalaires");
+}
+
+// sparse(m, n) ou sparse(i, j, v, m, n) : dimensions en tête de la liste des triplets
+Value sparseFromTriplets(const std::vector<const Value*>& arguments) {
+    const size_t count = arguments.size();
+    const Value& rowsValue = *arguments[count - 2];
+    const Value& colsValue = *arguments[count - 1];
+    if (!rowsValue.isScalar() || !colsValue.isScalar()) {
+        throw std::runtime_error("Les dimensions d'une matrice creuse doivent être des entiers positifs");
+    }
+    const double rows = rowsValue.toDouble();
+    const double cols = colsValue.toDouble();
+    if (rows < 0.0 || cols < 0.0 || rows != std::floor(rows) || cols != std::floor(cols)) {
+        throw std::runtime_error("Les dimensions d'une matrice creuse doivent être des entiers positifs");
+    }
+    
+    std::vector<SparseMatrix::Triplet> triplets;
+    if (count == 5) {
+        const Eigen::VectorXd i = tripletArgument(*arguments[0]);
+        const Eigen::VectorXd j = tripletArgument(*arguments[1]);
+        const Eigen::VectorXd v = tripletArgument(*arguments[2]);
+        const Eigen::Index length = std::max({i.size(), j.size(), v.size()});
+        for (const Eigen::VectorXd* column : {&i, &j, &v}) {
+            if (column->size() != 1 && column->size() != length) {
+                throw std::runtime_error("Les vecteurs i, j et v de sparse(i, j, v, m, n) doivent avoir la même longueur");
+            }
+        }
+        auto index = [](double value) {
+            if (value < 1.0 || value != std::floor(value)) {
+                throw std::runtime_error("Indice invalide dans sparse(i, j, v, m, n) : " + std::to_string(value));
+            }
+            return static_cast<Eigen::Index>(value) - 1;
+        };
+        triplets.reserve(static_cast<size_t>(length));
+        for (Eigen::Index k = 0; k < length; ++k) {
+            triplets.emplace_back(index(i(i.size() == 1 ? 0 : k)), index(j(j.size() == 1 ? 0 : k)),
+                                  v(v.size() == 1 ? 0 : k));
+        }
+    }
+    return SparseMatrix(static_cast<Eigen::Index>(rows), static_cast<Eigen::Index>(cols), triplets);
+}
+
+// cg(A, b [, tol [, maxit]]) et bicgstab(A, b [, tol [, maxit]])
+Value solveIterative(FunctionId function, const std::vector<const Value*>& arguments) {
+    const char* name = function == FunctionId::Cg ? "cg" : "bicgstab";
+    const Value& a = *arguments[0];
+    const Value& b = *arguments[1];
+    if (!a.isSparse()) {
+        throw std::runtime_error(std::string("La fonction ") + name + " requiert une matrice creuse (utiliser sparse(A))");
+    }
+    const SparseMatrix& matrix = a.as<SparseMatrix>();
+    
+    // Vecteur ou matrice colonne
+    Eigen::VectorXd rhs;
+    if (b.isVector()) {
+        rhs = b.as<Vector>().getData();
+    } else if (b.isMatrix() && b.as<Matrix>().cols() == 1) {
+        rhs = b.as<Matrix>().getData().col(0);
+    }
+    if (rhs.size() == 0 || static_cast<size_t>(rhs.size()) != matrix.rows()) {
+        throw std::runtime_error(std::string("Le second membre de ") + name + " doit être un vecteur de " +
+                                 std::to_string(matrix.rows()) + " éléments");
+    }
+    for (size_t i = 2; i < arguments.size(); ++i) {
+        if (!arguments[i]->isScalar()) {
+            throw std::runtime_error(std::string("La tolérance et le nombre d'itérations de ") + name +
+                                     " doivent être des scalaires");
+        }
+    }
+    
+    const double tolerance = arguments.size() > 2 ? arguments[2]->toDouble() : SolverInfo::DEFAULT_TOLERANCE;
+    const auto iterations = arguments.size() > 3 ? SparseMatrix::iterationLimit(arguments[3]->toDouble()) : 0;
+    const IterativeMethod method = function == FunctionId::Cg ? IterativeMethod::ConjugateGradient
+                                                              : IterativeMethod::BiCgStab;
+    return Vector(matrix.solveIterative(method, rhs, tolerance, iterations));
+}
+
+Value transposeValue(const Value& value) {
+    switch (value.kind()) {
+        case ValueKind::Scalar:
+            return value.copy();
+        case ValueKind::Vector:
+            return Matrix(Eigen::MatrixXd(value.as<Vector>().getData().transpose()));
+        case ValueKind::Matrix:
+            return value.as<Matrix>().transpose();
+        case ValueKind::Sparse:
+            return value.as<SparseMatrix>().transpose();
+    }
+    return {};
+}
+
+// Nœud portant le type et les dimensions d'une valeur (un vecteur est n x 1)
+AstPtr typedOperand(const Value& value) {
+    auto node = std::make_unique<AstNode>();
+    node->kind = NodeKind::Variable;
+    node->type = value.kind();
+    switch (value.kind()) {
+        case ValueKind::Scalar:
+            break;
+        case ValueKind::Vector:
+            node->rows = static_cast<Eigen::Index>(value.as<Vector>().size());
+            break;
+        case ValueKind::Matrix:
+            node->rows = static_cast<Eigen::Index>(value.as<Matrix>().rows());
+            node->cols = static_cast<Eigen::Index>(value.as<Matrix>().cols());
+            break;
+        case ValueKind::Sparse:
+            node->rows = static_cast<Eigen::Index>(value.as<SparseMatrix>().rows());
+            node->cols = static_cast<Eigen::Index>(value.as<SparseMatrix>().cols());
+            break;
+    }
+    return node;
+}
+
+// Vecteur vu comme une matrice n x 1 (opérateurs entre vecteur et matrice)
+Value columnMatrix(const Value& value) {
+    const Vector& vector = value.as<Vector>();
+    Matrix column(Eigen::MatrixXd(vector.getData()));
+    return vector.dtype() == DType::F64 ? Value(std::move(column)) : Value(column.astype(vector.dtype()));
+}
+
+// Ramène un résultat au type donné par le typage (scalaire 1 x 1, vecteur n x 1)
+Value conform(Value result, ValueKind type) {
+    if (result.kind() == type || result.isSparse()) {
+        return result;
+    }
+    if (type == ValueKind::Scalar) {
+        return Scalar(result.isVector() ? result.as<Vector>().getData()(0) : result.as<Matrix>().getData()(0, 0));
+    }
+    if (type == ValueKind::Vector && result.isMatrix()) {
+        const Matrix& matrix = result.as<Matrix>();
+        Vector column(Eigen::VectorXd(matrix.getData().col(0)));
+        return matrix.dtype() == DType::F64 ? Value(std::move(column)) : Value(column.astype(matrix.dtype()));
+    }
+    if (type == ValueKind::Matrix && result.isVector()) {
+        return columnMatrix(result);
+    }
+    return result;
+}
+
+// Calcul d'un opérateur, sans vérification des dimensions
+Value computeBinary(BinaryOp op, const Value& lhs, const Value& rhs) {
+    switch (op) {
+        case BinaryOp::Add: return lhs + rhs;
+        case BinaryOp::Sub: return lhs - rhs;
+        case BinaryOp::Mul: return lhs * rhs;
+        case BinaryOp::Div: return divideValues(lhs, rhs);
+        case BinaryOp::Pow: return powerValues(lhs, rhs);
+        case BinaryOp::ElemMul: return combineElements(lhs, rhs, [](double a, double b) { return a * b; }, ".*");
+        case BinaryOp::ElemDiv: return combineElements(lhs, rhs, [](double a, double b) { return a / b; }, "./");
+        case BinaryOp::ElemPow:
+            return combineElements(lhs, rhs, [](double a, double b) { return std::pow(a, b); }, ".^");
+        case BinaryOp::LeftDiv: return solveValues(lhs, rhs);
+    }
+    return {};
+}
+
+// Opérateur binaire : hors scalaires, type et dimensions donnés par les règles
+// du BytecodeCompiler, pour des résultats identiques à ceux du bytecode
+Value applyBinary(BinaryOp op, const Value& lhs, const Value& rhs) {
+    if (lhs.isScalar() && rhs.isScalar()) {
+        return computeBinary(op, lhs, rhs);
+    }
+    
+    AstNode node;
+    node.kind = NodeKind::Binary;
+    node.binaryOp = op;
+    node.children.push_back(typedOperand(lhs));
+    node.children.push_back(typedOperand(rhs));
+    BytecodeCompiler::typeBinary(node);
+    if (node.binaryOp != op) {
+        // s \ X : X / s
+        return computeBinary(node.binaryOp, rhs, lhs);
+    }
+    
+    // Creuse + dense est dense : la matrice creuse est d'abord convertie
+    if ((op == BinaryOp::Add || op == BinaryOp::Sub) && lhs.isSparse() != rhs.isSparse()) {
+        const Value& dense = lhs.isSparse() ? rhs : lhs;
+        const Value converted = (lhs.isSparse() ? lhs : rhs).as<SparseMatrix>().toDense();
+        const Value& denseLhs = lhs.isSparse() ? converted : dense;
+        const Value& denseRhs = lhs.isSparse() ? dense : converted;
+        return applyBinary(op, denseLhs, denseRhs);
+    }
+    
+    // Dense * creuse : (S' * X')'
+    if (op == BinaryOp::Mul && rhs.isSparse() && !lhs.isSparse()) {
+        const Value dense = lhs.isVector() ? columnMatrix(lhs) : lhs.copy();
+        return conform(transposeValue(computeBinary(op, transposeValue(rhs), transposeValue(dense))), node.type);
+    }
+    
+    // Les opérateurs des valeurs ne combinent pas un vecteur et une matrice : le vecteur devient n x 1
+    if (lhs.isVector() && rhs.isMatrix()) {
+        return conform(computeBinary(op, columnMatrix(lhs), rhs), node.type);
+    }
+    if (lhs.isMatrix() && rhs.isVector() && op != BinaryOp::Mul && op != BinaryOp::LeftDiv) {
+        return conform(computeBinary(op, lhs, columnMatrix(rhs)), node.type);
+    }
+    return conform(computeBinary(op, lhs, rhs), node.type);
+}
+
+Value applyFunction(FunctionId function, const std::vector<const Value*>& arguments) {
+    const Value& x = *arguments[0];
+    switch (function) {
+        case FunctionId::Sin: return mapElements(x, [](double a) { return std::sin(a); }, "sin");
+        case FunctionId::Cos: return mapElements(x, [](double a) { return std::cos(a); }, "cos");
+        case FunctionId::Tan: return mapElements(x, [](double a) { return std::tan(a); }, "tan");
+        case FunctionId::Exp: return mapElements(x, [](double a) { return std::exp(a); }, "exp");
+        case FunctionId::Log: return mapElements(x, [](double a) { return std::log(a); }, "log");
+        case FunctionId::Log10: return mapElements(x, [](double a) { return std::log10(a); }, "log10");
+        case FunctionId::Sqrt: return mapElements(x, [](double a) { return std::sqrt(a); }, "sqrt");
+        case FunctionId::Abs: return mapElements(x, [](double a) { return std::abs(a); }, "abs");
+        
+        case FunctionId::Det:
+            if (x.isMatrix()) {
+                return x.as<Matrix>().determinant();
+            }
+            if (x.isSparse()) {
+                return Scalar(x.as<SparseMatrix>().determinant());
+            }
+            break;
+        
+        case FunctionId::Inv:
+            if (x.isMatrix()) {
+                return x.as<Matrix>().inverse();
+            }
+            if (x.isScalar()) {
+                return Scalar(1.0 / x.toDouble());
+            }
+            break;
+        
+        case FunctionId::Trace:
+            if (x.isMatrix()) {
+                return Scalar(x.as<Matrix>().getData().trace());
+            }
+            break;
+        
+        case FunctionId::Norm:
+            switch (x.kind()) {
+                case ValueKind::Scalar: return Scalar(std::abs(x.toDouble()));
+                case ValueKind::Vector: return Scalar(x.as<Vector>().getData().norm());
+                case ValueKind::Matrix: return Scalar(x.as<Matrix>().getData().norm());
+                case ValueKind::Sparse: return Scalar(x.as<SparseMatrix>().getData().norm());
+            }
+            break;
+        
+        case FunctionId::Sum:
+            switch (x.kind()) {
+                case ValueKind::Scalar: return x.copy();
+                case ValueKind::Vector: return Scalar(x.as<Vector>().getData().sum());
+                case ValueKind::Matrix: return Scalar(x.as<Matrix>().getData().sum());
+                case ValueKind::Sparse: return Scalar(x.as<SparseMatrix>().getData().sum());
+            }
+            break;
+        
+        case FunctionId::Nnz:
+            switch (x.kind()) {
+                case ValueKind::Scalar: return Scalar(x.toDouble() != 0.0 ? 1.0 : 0.0);
+                case ValueKind::Vector:
+                    return Scalar(static_cast<double>((x.as<Vector>().getData().array() != 0.0).count()));
+                case ValueKind::Matrix:
+                    return Scalar(static_cast<double>((x.as<Matrix>().getData().array() != 0.0).count()));
+                case ValueKind::Sparse: return Scalar(static_cast<double>(x.as<SparseMatrix>().nonZeros()));
+            }
+            break;
+        
+        case FunctionId::Transpose:
+            return transposeValue(x);
+        
+        case FunctionId::Solve:
+            return applyBinary(BinaryOp::LeftDiv, x, *arguments[1]);
+        
+        case FunctionId::Sparse:
+            if (arguments.size() > 1) {
+                return sparseFromTriplets(arguments);
+            }
+            if (x.isMatrix()) {
+                return SparseMatrix(x.as<Matrix>().getData());
+            }
+            if (x.isVector()) {
+                return SparseMatrix(Eigen::MatrixXd(x.as<Vector>().getData()));
+            }
+            if (x.isSparse()) {
+                return x.copy();
+            }
+            break;
+        
+        case FunctionId::Cg:
+        case FunctionId::BiCgStab:
+            return solveIterative(function, arguments);
+        
+        case FunctionId::Full:
+            if (x.isSparse()) {
+                return x.as<SparseMatrix>().toDense();
+            }
+            return x.copy();
+        
+        case FunctionId::Single:
+        case FunctionId::Double:
+        case FunctionId::Int32:
+        case FunctionId::Int64: {
+            const DType dtype = function == FunctionId::Single ? DType::F32
+                              : function == FunctionId::Double ? DType::F64
+                              : function == FunctionId::Int32 ? DType::I32 : DType::I64;
+            switch (x.kind()) {
+                case ValueKind::Scalar:
+                    return Scalar(dispatch(dtype, [&](auto tag) {
+                        using T = typename decltype(tag)::type;
+                        return static_cast<double>(narrow<T>(x.toDouble()));
+                    }));
+                case ValueKind::Vector: return x.as<Vector>().astype(dtype);
+                case ValueKind::Matrix: return x.as<Matrix>().astype(dtype);
+                case ValueKind::Sparse: break;
+            }
+            break;
+        }
+        
+        default:
+            throw std::runtime_error("Fonction non supportée par l'évaluateur natif");
+    }
+    throw std::runtime_error(std::string("Fonction non définie pour un argument de type ") + x.typeName());
+}
+
+} // namespace
+
+NativeEvaluator::NativeEvaluator(size_t cacheCapacity) : cacheCapacity_(cacheCapacity) {}
+
+NativeEvaluator::~NativeEvaluator() = default;
+
+Value NativeEvaluator::evaluate(const std::string& expression) {
+    const Compiled& compiled = compile(expression);
+    
+    // Constantes et variables sont lues en place ; seuls les calculs produisent une valeur
+    std::vector<Value> results(compiled.instructions.size());
+    std::vector<const Value*> slots(compiled.instructions.size(), nullptr);
+    std::vector<const Value*> operands;
+    for (size_t i = 0; i < compiled.instructions.size(); ++i) {
+        const Instruction& instruction = compiled.instructions[i];
+        if (instruction.kind == OpKind::Constant) {
+            slots[i] = &instruction.constant;
+            continue;
+        }
+        if (instruction.kind == OpKind::Variable) {
+            slots[i] = instruction.variable;
+            continue;
+        }
+        operands.clear();
+        for (int operand : instruction.operands) {
+            operands.push_back(slots[operand]);
+        }
+        results[i] = execute(instruction, operands);
+        slots[i] = &results[i];
+    }
+    
+    if (slots[compiled.result] == &results[compiled.result]) {
+        return std::move(results[compiled.result]);
+    }
+    return slots[compiled.result]->copy();
+}
+
+bool NativeEvaluator::isValid(const std::string& expression) {
+    try {
+        compile(expression);
+        return true;
+    } catch (const std::runtime_error&) {
+        return false;
+    }
+}
+
+Vector NativeEvaluator::evaluateBatch(const std::string& expression, const std::vector<BatchColumn>& columns) {
+    BatchProgram::rowCount(columns);
+    
+    std::vector<std::string> names;
+    names.reserve(columns.size());
+    for (const BatchColumn& column : columns) {
+        names.push_back(column.name);
+    }
+    auto program = BatchProgram::compile(expression, names, *this);
+    if (!program) {
+        throw std::runtime_error("Formule non évaluable par lots par l'évaluateur natif : " + expression);
+    }
+    return Vector(program->run(columns));
+}
+
+void NativeEvaluator::setVariable(const std::string& name, Value value) {
+    // Affectation en place : les pointeurs des expressions compilées restent valides
+    variables_[name] = std::move(value);
+}
+
+Value* NativeEvaluator::getVariable(const std::string& name) {
+    auto it = variables_.find(name);
+    return it != variables_.end() ? &it->second : nullptr;
+}
+
+void NativeEvaluator::removeVariable(const std::string& name) {
+    if (variables_.erase(name) > 0) {
+        dropCompiledExpressions();
+    }
+}
+
+void NativeEvaluator::clearVariables() {
+    variables_.clear();
+    dropCompiledExpressions();
+}
+
+const NativeEvaluator::Compiled& NativeEvaluator::compile(const std::string& expression) {
+    auto it = cacheIndex_.find(expression);
+    if (it != cacheIndex_.end()) {
+        // Remonter l'entrée en tête de la liste LRU
+        cacheEntries_.splice(cacheEntries_.begin(), cacheEntries_, it->second);
+        return it->second->second;
+    }
+    
+    Compiled compiled;
+    try {
+        compiled.root = Parser::parse(expression);
+    } catch (const SyntaxError& e) {
+        throw std::runtime_error("Expression invalide: " + expression + " (" + e.what() + ")");
+    }
+    std::unordered_map<std::string, int> signatures;
+    compiled.result = translate(*compiled.root, compiled, signatures);
+    
+    cacheEntries_.emplace_front(expression, std::move(compiled));
+    cacheIndex_.emplace(cacheEntries_.front().first, cacheEntries_.begin());
+    const Compiled& result = cacheEntries_.front().second;
+    
+    // Cache désactivé (capacité 0) : seule la dernière expression est conservée
+    while (cacheEntries_.size() > std::max<size_t>(cacheCapacity_, 1)) {
+        cacheIndex_.erase(cacheEntries_.back().first);
+        cacheEntries_.pop_back();
+    }
+    return result;
+}
+
+int NativeEvaluator::translate(const AstNode& node, Compiled& compiled,
+                               std::unordered_map<std::string, int>& signatures) {
+    Instruction instruction;
+    switch (node.kind) {
+        case NodeKind::Number:
+            instruction.constant = Scalar(node.number);
+            break;
+        
+        case NodeKind::Variable:
+            instruction.kind = OpKind::Variable;
+            instruction.variable = getVariable(node.name);
+            if (!instruction.variable) {
+                throw std::runtime_error("Variable inconnue : " + node.name);
+            }
+            break;
+        
+        case NodeKind::Unary:
+            instruction.kind = OpKind::Unary;
+            instruction.unaryOp = node.unaryOp;
+            break;
+        
+        case NodeKind::Binary:
+            instruction.kind = OpKind::Binary;
+            instruction.binaryOp = node.binaryOp;
+            break;
+        
+        case NodeKind::Transpose:
+            instruction.kind = OpKind::Transpose;
+            break;
+        
+        case NodeKind::Call: {
+            instruction.kind = OpKind::Call;
+            instruction.function = BytecodeCompiler::lookupFunction(node.name);
+            if (instruction.function == FunctionId::Unknown) {
+                throw std::runtime_error("Fonction inconnue de l'évaluateur natif : " + node.name);
+            }
+            // Nombres d'arguments acceptés par le BytecodeCompiler
+            const size_t count = node.children.size();
+            bool accepted = count == 1;
+            switch (instruction.function) {
+                case FunctionId::Solve: accepted = count == 2; break;
+                case FunctionId::Sparse: accepted = count == 1 || count == 2 || count == 5; break;
+                case FunctionId::Cg:
+                case FunctionId::BiCgStab: accepted = count >= 2 && count <= 4; break;
+                default: break;
+            }
+            if (!accepted) {
+                throw std::runtime_error("La fonction " + node.name + " n'accepte pas " + std::to_string(count) +
+                                         " arguments");
+            }
+            break;
+        }
+        
+        case NodeKind::Literal:
+            instruction.kind = OpKind::Literal;
+            instruction.literal = &node;
+            break;
+        
+        default:
+            throw std::runtime_error("Indexation non supportée par l'évaluateur natif");
+    }
+    
+    for (const auto& child : node.children) {
+        instruction.operands.push_back(translate(*child, compiled, signatures));
+    }
+    return emit(std::move(instruction), compiled, signatures);
+}
+
+int NativeEvaluator::emit(Instruction instruction, Compiled& compiled,
+                          std::unordered_map<std::string, int>& signatures) {
+    auto append = [&](Instruction added) {
+        compiled.instructions.push_back(std::move(added));
+        return static_cast<int>(compiled.instructions.size()) - 1;
+    };
+    if (instruction.kind == OpKind::Constant) {
+        return append(std::move(instruction));
+    }
+    
+    // Repliement : toutes les opérandes sont constantes (un littéral peut n'en avoir aucune)
+    bool constant = instruction.kind != OpKind::Variable;
+    std::vector<const Value*> operands;
+    for (int operand : instruction.operands) {
+        const Instruction& source = compiled.instructions[operand];
+        constant = constant && source.kind == OpKind::Constant;
+        operands.push_back(&source.constant);
+    }
+    if (constant) {
+        Instruction folded;
+        folded.constant = execute(instruction, operands);
+        return append(std::move(folded));
+    }
+    
+    // Sous-expression commune : même opération sur les mêmes instructions
+    std::string signature;
+    switch (instruction.kind) {
+        case OpKind::Variable:
+            signature = "v " + std::to_string(reinterpret_cast<uintptr_t>(instruction.variable));
+            break;
+        case OpKind::Literal:
+            // Les éléments constants d'un littéral ne font pas partie de la signature
+            signature = "l " + std::to_string(reinterpret_cast<uintptr_t>(instruction.literal));
+            break;
+        default:
+            signature = std::to_string(static_cast<int>(instruction.kind)) + " " +
+                        std::to_string(static_cast<int>(instruction.unaryOp)) + " " +
+                        std::to_string(static_cast<int>(instruction.binaryOp)) + " " +
+                        std::to_string(static_cast<int>(instruction.function));
+            break;
+    }
+    for (int operand : instruction.operands) {
+        signature += " " + std::to_string(operand);
+    }
+    
+    auto it = signatures.find(signature);
+    if (it != signatures.end()) {
+        return it->second;
+    }
+    const int index = append(std::move(instruction));
+    signatures.emplace(std::move(signature), index);
+    return index;
+}
+
+Value NativeEvaluator::execute(const Instruction& instruction, const std::vector<const Value*>& operands) {
+    switch (instruction.kind) {
+        case OpKind::Unary:
+            if (instruction.unaryOp == UnaryOp::Negate) {
+                return Value(-1.0) * *operands[0];
+            }
+            return operands[0]->copy();
+        
+        case OpKind::Binary:
+            return applyBinary(instruction.binaryOp, *operands[0], *operands[1]);
+        
+        case OpKind::Transpose:
+            return transposeValue(*operands[0]);
+        
+        case OpKind::Call:
+            return applyFunction(instruction.function, operands);
+        
+        case OpKind::Literal: {
+            // Éléments ligne par ligne, les éléments calculés à leur position
+            const AstNode& literal = *instruction.literal;
+            std::vector<double> elements = literal.elements;
+            for (size_t i = 0; i < operands.size(); ++i) {
+                if (!operands[i]->isScalar()) {
+                    throw std::runtime_error("Les éléments d'un littéral doivent être des scalaires");
+                }
+                elements[literal.positions[i]] = operands[i]->toDouble();
+            }
+            if (literal.type == ValueKind::Vector) {
+                return Vector(Eigen::Map<const Eigen::VectorXd>(elements.data(), literal.rows));
+            }
+            using RowMajorMatrix = Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+            return Matrix(Eigen::MatrixXd(Eigen::Map<const RowMajorMatrix>(elements.data(), literal.rows,
+                                                                            literal.cols)));
+        }
+        
+        default:
+            break;
+    }
+    return {};
+}
+
+void NativeEvaluator::dropCompiledExpressions() {
+    cacheEntries_.clear();
+    cacheIndex_.clear();
+}
+
+} // namespace FusioCore
@@ -0,0 +1,325 @@
+#include "Expression/Parser.hpp"
+#include <cctype>
+#include <stdexcept>
+#include <utility>
+
+namespace FusioCore {
+
+namespace {
+
+// Priorités des opérateurs
+constexpr int PRECEDENCE_ADDITIVE = 10;
+constexpr int PRECEDENCE_MULTIPLICATIVE = 20;
+constexpr int PRECEDENCE_UNARY = 25;
+constexpr int PRECEDENCE_POWER = 30;
+
+struct BinaryInfo {
+    BinaryOp op;
+    int precedence;
+    bool rightAssociative;
+};
+
+// Retourne false si le lexème n'est pas un opérateur binaire
+bool binaryInfo(TokenType type, BinaryInfo& info) {
+    switch (type) {
+        case TokenType::Plus:     info = {BinaryOp::Add, PRECEDENCE_ADDITIVE, false}; return true;
+        case TokenType::Minus:    info = {BinaryOp::Sub, PRECEDENCE_ADDITIVE, false}; return true;
+        case TokenType::Star:     info = {BinaryOp::Mul, PRECEDENCE_MULTIPLICATIVE, false}; return true;
+        case TokenType::Slash:    info = {BinaryOp::Div, PRECEDENCE_MULTIPLICATIVE, false}; return true;
+        case TokenType::DotStar:  info = {BinaryOp::ElemMul, PRECEDENCE_MULTIPLICATIVE, false}; return true;
+        case TokenType::DotSlash: info = {BinaryOp::ElemDiv, PRECEDENCE_MULTIPLICATIVE, false}; return true;
+        case TokenType::Backslash: info = {BinaryOp::LeftDiv, PRECEDENCE_MULTIPLICATIVE, false}; return true;
+        case TokenType::Caret:    info = {BinaryOp::Pow, PRECEDENCE_POWER, true}; return true;
+        case TokenType::DotCaret: info = {BinaryOp::ElemPow, PRECEDENCE_POWER, true}; return true;
+        default: return false;
+    }
+}
+
+AstPtr makeNode(NodeKind kind) {
+    auto node = std::make_unique<AstNode>();
+    node->kind = kind;
+    return node;
+}
+
+} // namespace
+
+AstPtr Parser::parse(const std::string& source) {
+    Parser parser(source);
+    AstPtr root = parser.parseExpression(0);
+    if (parser.peek().type != TokenType::End) {
+        throw SyntaxError("Lexème inattendu '" + parser.peek().text + "' à la position " +
+                          std::to_string(parser.peek().position));
+    }
+    return root;
+}
+
+Parser::Parser(const std::string& source) : source_(source), lexer_(source) {}
+
+AstPtr Parser::parseExpression(int minPrecedence) {
+    AstPtr left = parsePrefix();
+    
+    while (true) {
+        const Token& token = peek();
+        
+        // Transposée postfixe : priorité maximale
+        if (token.type == TokenType::Apostrophe) {
+            advance();
+            auto node = makeNode(NodeKind::Transpose);
+            node->children.push_back(std::move(left));
+            left = std::move(node);
+            continue;
+        }
+        
+        BinaryInfo info{};
+        if (inBrackets_ && startsElement()) {
+            break;
+        }
+        if (!binaryInfo(token.type, info) || info.precedence <= minPrecedence) {
+            break;
+        }
+        advance();
+        
+        AstPtr right = parseExpression(info.rightAssociative ? info.precedence - 1 : info.precedence);
+        auto node = makeNode(NodeKind::Binary);
+        node->binaryOp = info.op;
+        node->children.push_back(std::move(left));
+        node->children.push_back(std::move(right));
+        left = std::move(node);
+    }
+    
+    return left;
+}
+
+AstPtr Parser::parsePrefix() {
+    const Token token = advance();
+    
+    switch (token.type) {
+        case TokenType::Number: {
+            auto node = makeNode(NodeKind::Number);
+            node->number = token.number;
+            return node;
+        }
+        
+        case TokenType::Identifier: {
+            // Appel de fonction (entre crochets, "f (x)" désigne deux éléments)
+            if (peek().type == TokenType::LParen && !(inBrackets_ && peek().spaceBefore)) {
+                advance();
+                auto node = makeNode(NodeKind::Call);
+                node->name = token.text;
+                bool inBrackets = inBrackets_;
+                inBrackets_ = false;
+                if (peek().type != TokenType::RParen) {
+                    node->children.push_back(parseArgument());
+                    while (peek().type == TokenType::Comma) {
+                        advance();
+                        node->children.push_back(parseArgument());
+                    }
+                }
+                expect(TokenType::RParen, ")");
+                inBrackets_ = inBrackets;
+                return node;
+            }
+            auto node = makeNode(NodeKind::Variable);
+            node->name = token.text;
+            return node;
+        }
+        
+        case TokenType::LParen:
+            return parseGrouped();
+            
+        case TokenType::LBracket:
+            return parseLiteral(token);
+        
+        case TokenType::Minus:
+        case TokenType::Plus: {
+            auto node = makeNode(NodeKind::Unary);
+            node->unaryOp = token.type == TokenType::Minus ? UnaryOp::Negate : UnaryOp::Plus;
+            node->children.push_back(parseExpression(PRECEDENCE_UNARY));
+            return node;
+        }
+        
+        default:
+            throw SyntaxError("Lexème inattendu '" + token.text + "' à la position " +
+                              std::to_string(token.position));
+    }
+}
+
+AstPtr Parser::parseArgument() {
+    // ':' seul : toutes les lignes ou colonnes
+    if (peek().type == TokenType::Colon) {
+        advance();
+        return makeNode(NodeKind::Range);
+    }
+    
+    AstPtr first = parseExpression(0);
+    if (peek().type != TokenType::Colon) {
+        return first;
+    }
+    advance();
+    auto node = makeNode(NodeKind::Range);
+    node->children.push_back(std::move(first));
+    node->children.push_back(parseExpression(0));
+    if (peek().type == TokenType::Colon) {
+        advance();
+        node->children.push_back(parseExpression(0));
+    }
+    return node;
+}
+
+AstPtr Parser::parseGrouped() {
+    bool inBrackets = inBrackets_;
+    inBrackets_ = false;
+    AstPtr inner = parseExpression(0);
+    expect(TokenType::RParen, ")");
+    inBrackets_ = inBrackets;
+    return inner;
+}
+
+AstPtr Parser::parseLiteral(const Token& open) {
+    auto node = makeNode(NodeKind::Literal);
+    bool inBrackets = inBrackets_;
+    inBrackets_ = true;
+    
+    std::vector<size_t> rowLengths;
+    size_t current = 0;
+    bool matrix = false;
+    bool separated = false;  // Une virgule attend un élément
+    
+    while (true) {
+        const Token& token = peek();
+        if (token.type == TokenType::End) {
+            throw SyntaxError("']' attendu pour le crochet ouvert à la position " + std::to_string(open.position));
+        }
+        if (token.type == TokenType::RBracket || token.type == TokenType::Semicolon ||
+            token.type == TokenType::Comma) {
+            if (separated || (token.type == TokenType::Comma && current == 0)) {
+                throw SyntaxError("Élément attendu à la position " + std::to_string(token.position));
+            }
+            const TokenType separator = advance().type;
+            if (separator == TokenType::Comma) {
+                separated = true;
+                continue;
+            }
+            // Les lignes vides sont ignorées
+            if (current > 0) {
+                rowLengths.push_back(current);
+                current = 0;
+            }
+            if (separator == TokenType::RBracket) {
+                break;
+            }
+            matrix = true;
+            continue;
+        }
+        
+        // Nombre isolé : écrit directement, sans nœud ni compilation
+        double value = 0.0;
+        if (parseConstantElement(value)) {
+            node->elements.push_back(value);
+        } else {
+            size_t begin = token.position;
+            AstPtr element = parseExpression(0);
+            size_t end = peek().position;
+            while (end > begin && std::isspace(static_cast<unsigned char>(source_[end - 1]))) {
+                --end;
+            }
+            element->source = source_.substr(begin, end - begin);
+            node->positions.push_back(node->elements.size());
+            node->elements.push_back(0.0);
+            node->children.push_back(std::move(element));
+        }
+        ++current;
+        separated = false;
+    }
+    inBrackets_ = inBrackets;
+    
+    if (rowLengths.empty()) {
+        throw std::runtime_error("Matrice vide");
+    }
+    
+    // Toutes les lignes doivent avoir la longueur de la première
+    const size_t cols = rowLengths.front();
+    for (size_t length : rowLengths) {
+        if (length != cols) {
+            throw std::runtime_error("Le nombre d'éléments (" + std::to_string(node->elements.size()) +
+                                     ") ne correspond pas aux dimensions de la matrice (" +
+                                     std::to_string(rowLengths.size()) + "x" + std::to_string(cols) + ")");
+        }
+    }
+    
+    if (matrix) {
+        node->type = ValueKind::Matrix;
+        node->rows = static_cast<Eigen::Index>(rowLengths.size());
+        node->cols = static_cast<Eigen::Index>(cols);
+    } else {
+        node->type = ValueKind::Vector;
+        node->rows = static_cast<Eigen::Index>(cols);
+        node->cols = 1;
+    }
+    return node;
+}
+
+bool Parser::parseConstantElement(double& value) {
+    size_t offset = 0;
+    if (peek().type == TokenType::Plus || peek().type == TokenType::Minus) {
+        offset = 1;
+    }
+    if (peek(offset).type != TokenType::Number) {
+        return false;
+    }
+    
+    // L'élément doit s'arrêter au nombre : "2^2", "2'" ou "2 + x" sont des expressions
+    BinaryInfo info{};
+    const TokenType next = peek(offset + 1).type;
+    if (next == TokenType::Apostrophe || (binaryInfo(next, info) && !startsElement(offset + 1))) {
+        return false;
+    }
+    
+    value = peek(offset).number;
+    if (offset > 0 && peek().type == TokenType::Minus) {
+        value = -value;
+    }
+    for (size_t i = 0; i <= offset; ++i) {
+        advance();
+    }
+    return true;
+}
+
+bool Parser::startsElement(size_t offset) {
+    const Token& token = peek(offset);
+    if (!token.spaceBefore) {
+        return false;
+    }
+    // "a -b" : signe collé à l'opérande suivant
+    if (token.type == TokenType::Plus || token.type == TokenType::Minus) {
+        const Token& next = peek(offset + 1);
+        return next.type != TokenType::End && !next.spaceBefore;
+    }
+    return false;
+}
+
+const Token& Parser::peek(size_t offset) {
+    while (lookahead_.size() <= offset) {
+        lookahead_.push_back(lexer_.next());
+    }
+    return lookahead_[offset];
+}
+
+Token Parser::advance() {
+    if (peek().type == TokenType::End) {
+        return lookahead_.front();
+    }
+    Token token = std::move(lookahead_.front());
+    lookahead_.pop_front();
+    return token;
+}
+
+void Parser::expect(TokenType type, const char* what) {
+    if (peek().type != type) {
+        throw SyntaxError(std::string("'") + what + "' attendu à la position " +
+                          std::to_string(peek().position));
+    }
+    advance();
+}
+
+} // namespace FusioCore
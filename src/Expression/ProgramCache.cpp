@@ -0,0 +1,62 @@
+#include "Expression/ProgramCache.hpp"
+#include <algorithm>
+#include <mutex>
+
+namespace FusioCore {
+
+ProgramCache::ProgramCache(size_t capacity) : capacity_(std::max<size_t>(capacity, 1)) {}
+
+std::vector<std::shared_ptr<const Program>> ProgramCache::find(const std::string& statement,
+                                                                EvaluatorType evaluator) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    auto it = index_.find(statement);
+    if (it == index_.end()) {
+        return {};
+    }
+    std::vector<std::shared_ptr<const Program>> programs;
+    for (const Specialization& specialization : it->second->programs) {
+        if (specialization.program->sources.empty() || specialization.evaluator == evaluator) {
+            programs.push_back(specialization.program);
+        }
+    }
+    return programs;
+}
+
+void ProgramCache::publish(const std::string& statement, EvaluatorType evaluator,
+                           std::shared_ptr<const Program> program) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    auto it = index_.find(statement);
+    if (it == index_.end()) {
+        entries_.emplace_front();
+        Entry& entry = entries_.front();
+        entry.text = statement;
+        entry.programs.push_back({evaluator, std::move(program)});
+        index_.emplace(entry.text, entries_.begin());
+        
+        while (entries_.size() > capacity_) {
+            index_.erase(entries_.back().text);
+            entries_.pop_back();
+        }
+        return;
+    }
+    
+    // La spécialisation la plus récente est essayée en premier
+    auto& programs = it->second->programs;
+    programs.insert(programs.begin(), {evaluator, std::move(program)});
+    if (programs.size() > MAX_SPECIALIZATIONS) {
+        programs.pop_back();
+    }
+}
+
+size_t ProgramCache::size() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return entries_.size();
+}
+
+void ProgramCache::clear() {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    index_.clear();
+    entries_.clear();
+}
+
+} // namespace FusioCore
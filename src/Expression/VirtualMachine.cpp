@@ -0,0 +1,670 @@
+#include "Expression/VirtualMachine.hpp"
+#include "Runtime/ThreadPool.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+namespace FusioCore {
+
+namespace {
+
+double applyScalarFunction(FunctionId function, double x) {
+    switch (function) {
+        case FunctionId::Sin: return std::sin(x);
+        case FunctionId::Cos: return std::cos(x);
+        case FunctionId::Tan: return std::tan(x);
+        case FunctionId::Exp: return std::exp(x);
+        case FunctionId::Log: return std::log(x);
+        case FunctionId::Log10: return std::log10(x);
+        case FunctionId::Sqrt: return std::sqrt(x);
+        case FunctionId::Abs: return std::abs(x);
+        case FunctionId::Det: return x;
+        case FunctionId::Inv: return 1.0 / x;
+        case FunctionId::Trace: return x;
+        case FunctionId::Norm: return std::abs(x);
+        case FunctionId::Sum: return x;
+        case FunctionId::Transpose: return x;
+        case FunctionId::Full: return x;
+        case FunctionId::Nnz: return x != 0.0 ? 1.0 : 0.0;
+        case FunctionId::Single: return static_cast<double>(narrow<float>(x));
+        case FunctionId::Double: return x;
+        case FunctionId::Int32: return static_cast<double>(narrow<int32_t>(x));
+        case FunctionId::Int64: return static_cast<double>(narrow<int64_t>(x));
+        default: throw std::runtime_error("Fonction non supportée");
+    }
+}
+
+double applyScalarOperator(BinaryOp op, double a, double b) {
+    switch (op) {
+        case BinaryOp::Add: return a + b;
+        case BinaryOp::Sub: return a - b;
+        case BinaryOp::Mul:
+        case BinaryOp::ElemMul: return a * b;
+        case BinaryOp::Div:
+        case BinaryOp::ElemDiv: return a / b;
+        case BinaryOp::Pow:
+        case BinaryOp::ElemPow: return std::pow(a, b);
+        case BinaryOp::LeftDiv: return b / a;
+    }
+    throw std::runtime_error("Opérateur non supporté");
+}
+
+double reduceSparse(const SparseMatrix& matrix, FunctionId function) {
+    const SparseMatrix::Storage& data = matrix.getData();
+    switch (function) {
+        case FunctionId::Det: return matrix.determinant();
+        case FunctionId::Trace: return data.diagonal().sum();
+        case FunctionId::Norm: return data.norm();
+        case FunctionId::Sum: return data.sum();
+        case FunctionId::Nnz: return static_cast<double>(data.nonZeros());
+        default: throw std::runtime_error("Réduction non supportée");
+    }
+}
+
+// Triplets de sparse(i, j, v, m, n) : vecteurs de même longueur ou scalaires répétés
+std::vector<SparseMatrix::Triplet> gatherTriplets(const double* rows, const double* cols, const double* values,
+                                                  Eigen::Index rowCount, Eigen::Index colCount, Eigen::Index valueCount) {
+    const Eigen::Index count = std::max({rowCount, colCount, valueCount});
+    auto index = [](double value) {
+        if (value < 1.0 || value != std::floor(value)) {
+            throw std::runtime_error("Indice invalide dans sparse(i, j, v, m, n) : " + std::to_string(value));
+        }
+        return static_cast<Eigen::Index>(value) - 1;
+    };
+    std::vector<SparseMatrix::Triplet> triplets;
+    triplets.reserve(static_cast<size_t>(count));
+    for (Eigen::Index k = 0; k < count; ++k) {
+        triplets.emplace_back(index(rows[rowCount == 1 ? 0 : k]), index(cols[colCount == 1 ? 0 : k]),
+                              values[valueCount == 1 ? 0 : k]);
+    }
+    return triplets;
+}
+
+// Remet à zéro les liaisons d'un Frame à la fin d'une exécution
+struct BindingRelease {
+    VirtualMachine::Frame& frame;
+    
+    ~BindingRelease() {
+        std::fill(frame.bound.begin(), frame.bound.end(), nullptr);
+        std::fill(frame.sparse.begin(), frame.sparse.end(), nullptr);
+        for (auto& sparse : frame.sparseStorage) {
+            sparse.reset();
+        }
+        // Conversion en double d'une variable f32/i32/i64 : libérée dès la fin de l'exécution
+        for (int reg : frame.widened) {
+            frame.storage[reg] = Eigen::MatrixXd();
+            frame.data[reg] = nullptr;
+        }
+        frame.widened.clear();
+    }
+};
+
+// Indice d'élément de LoadElement/SetElement, vérifié sur les dimensions du registre
+Eigen::Index elementOffset(const Program& program, const Instruction& instruction, int reg) {
+    const Eigen::Index offset = program.offsets[instruction.aux];
+    const RegisterInfo& info = program.registers[reg];
+    if (offset < 0 || offset >= info.rows * info.cols) {
+        throw std::runtime_error("Indice hors limites : " + std::to_string(offset + 1) + " pour " +
+                                 std::to_string(info.rows) + "x" + std::to_string(info.cols));
+    }
+    return offset;
+}
+
+} // namespace
+
+VirtualMachine::VirtualMachine(IExpressionEvaluator& variables) : variables_(variables) {}
+
+Value VirtualMachine::execute(const Program& program, Frame& frame) {
+    BindingRelease release{frame};
+    if (!bind(program, frame)) {
+        return Value();
+    }
+    
+    // Le résultat est calculé directement dans le stockage de la valeur retournée
+    Value result;
+    const RegisterInfo& out = program.registers[program.result];
+    if (out.storage == RegisterStorage::Result && out.type != ValueKind::Sparse) {
+        if (out.type == ValueKind::Vector) {
+            result = Vector(static_cast<size_t>(out.rows));
+            frame.data[program.result] = result.as<Vector>().getData().data();
+        } else {
+            result = Matrix(static_cast<size_t>(out.rows), static_cast<size_t>(out.cols));
+            frame.data[program.result] = result.as<Matrix>().getData().data();
+        }
+    }
+    
+    for (const Instruction& instruction : program.code) {
+        step(program, frame, instruction);
+    }
+    
+    // Registres en double : le résultat est converti une fois vers le type de ses éléments
+    if (program.dtype != DType::F64 && out.storage == RegisterStorage::Result) {
+        if (out.type == ValueKind::Vector) {
+            result = result.as<Vector>().astype(program.dtype);
+        } else if (out.type == ValueKind::Matrix) {
+            result = result.as<Matrix>().astype(program.dtype);
+        }
+    }
+    
+    if (out.type == ValueKind::Scalar) {
+        // Scalaire stocké dans la valeur, sans allocation
+        result = Scalar(frame.data[program.result][0]);
+    } else if (out.type == ValueKind::Sparse && out.storage != RegisterStorage::Variable) {
+        result = *frame.sparse[program.result];
+    } else if (out.storage == RegisterStorage::Variable) {
+        // Une expression réduite à une variable retourne une copie de sa valeur,
+        // sans dupliquer les éléments (partagés jusqu'à une écriture)
+        const Value& value = *frame.bound[out.variable];
+        if (program.view >= 0) {
+            // Sous-matrice ou transposée : vue sur les éléments de la variable
+            const SliceInfo& slice = program.slices[program.view];
+            Matrix view = value.as<Matrix>().slice(slice.rows, slice.cols);
+            result = slice.transposed ? view.transpose() : std::move(view);
+        } else {
+            result = value.copy();
+        }
+    }
+    
+    if (!program.target.empty()) {
+        variables_.setVariable(program.target, result.copy());
+    }
+    return result;
+}
+
+bool VirtualMachine::bind(const Program& program, Frame& frame) {
+    // Première exécution : allocation des temporaires, conservés ensuite
+    const size_t count = program.registers.size();
+    if (frame.data.size() != count) {
+        frame.storage.assign(count, Eigen::MatrixXd());
+        frame.data.assign(count, nullptr);
+        for (size_t i = 0; i < count; ++i) {
+            const RegisterInfo& reg = program.registers[i];
+            if (reg.type != ValueKind::Sparse &&
+                (reg.storage == RegisterStorage::Temporary || reg.type == ValueKind::Scalar)) {
+                frame.storage[i].resize(reg.rows, reg.cols);
+                frame.data[i] = frame.storage[i].data();
+            }
+        }
+        frame.bound.assign(program.variables.size(), nullptr);
+        frame.sparse.assign(count, nullptr);
+        frame.sparseStorage.assign(count, std::nullopt);
+    }
+    
+    for (size_t i = 0; i < program.variables.size(); ++i) {
+        const VariableGuard& guard = program.variables[i];
+        // La variable est liée sans copie : son emplacement dans l'environnement
+        // reste valide pendant l'exécution
+        Value* value = variables_.getVariable(guard.name);
+        if ((value != nullptr) != guard.defined) {
+            return false;
+        }
+        if (!value) {
+            continue;
+        }
+        const Value& current = *value;
+        
+        if (current.empty()) {
+            return false;
+        }
+        
+        const ValueKind type = current.kind();
+        Eigen::Index rows = 1;
+        Eigen::Index cols = 1;
+        DType dtype = DType::F64;
+        switch (type) {
+            case ValueKind::Scalar:
+                break;
+            case ValueKind::Vector: {
+                const Vector& vector = current.as<Vector>();
+                rows = static_cast<Eigen::Index>(vector.size());
+                dtype = vector.dtype();
+                break;
+            }
+            case ValueKind::Matrix: {
+                const Matrix& matrix = current.as<Matrix>();
+                rows = static_cast<Eigen::Index>(matrix.rows());
+                cols = static_cast<Eigen::Index>(matrix.cols());
+                dtype = matrix.dtype();
+                break;
+            }
+            case ValueKind::Sparse: {
+                const SparseMatrix& sparse = current.as<SparseMatrix>();
+                rows = static_cast<Eigen::Index>(sparse.rows());
+                cols = static_cast<Eigen::Index>(sparse.cols());
+                break;
+            }
+        }
+        if (type != guard.type || rows != guard.rows || cols != guard.cols || dtype != guard.dtype) {
+            return false;
+        }
+        if (guard.pinned && current.toDouble() != guard.value) {
+            return false;
+        }
+        
+        if (guard.reg >= 0) {
+            // Les registres variables ne sont jamais des destinations
+            if (type == ValueKind::Scalar) {
+                frame.data[guard.reg][0] = current.toDouble();
+            } else if (dtype != DType::F64) {
+                // Éléments d'un autre type : convertis dans le stockage du Frame le temps
+                // de l'exécution, sans conserver de copie en double avec la valeur ni le Frame
+                Eigen::MatrixXd& storage = frame.storage[guard.reg];
+                dispatch(dtype, [&](auto tag) {
+                    using T = typename decltype(tag)::type;
+                    if (type == ValueKind::Vector) {
+                        storage = current.as<Vector>().getTypedData<T>().template cast<double>();
+                    } else {
+                        storage = current.as<Matrix>().getTypedData<T>().template cast<double>();
+                    }
+                });
+                frame.data[guard.reg] = storage.data();
+                frame.widened.push_back(guard.reg);
+            } else if (type == ValueKind::Vector) {
+                frame.data[guard.reg] = const_cast<double*>(current.as<Vector>().getData().data());
+            } else if (type == ValueKind::Sparse) {
+                frame.sparse[guard.reg] = &current.as<SparseMatrix>();
+            } else {
+                // Les registres sont contigus : une vue transposée ou sur des
+                // lignes est copiée une fois, dans la variable elle-même
+                Matrix& matrix = value->as<Matrix>();
+                matrix.materialize();
+                frame.data[guard.reg] = const_cast<double*>(std::as_const(matrix).getData().data());
+            }
+        }
+        frame.bound[i] = value;
+    }
+    return true;
+}
+
+void VirtualMachine::step(const Program& program, Frame& frame, const Instruction& instruction) {
+    auto scalar = [&](int reg) -> double& {
+        return frame.data[reg][0];
+    };
+    auto in = [&](int reg) {
+        const RegisterInfo& info = program.registers[reg];
+        return ConstMatrixMap(frame.data[reg], info.rows, info.cols);
+    };
+    auto out = [&](int reg) {
+        const RegisterInfo& info = program.registers[reg];
+        return MatrixOut(frame.data[reg], info.rows, info.cols);
+    };
+    auto setSparse = [&](int reg, SparseMatrix value) {
+        frame.sparse[reg] = &frame.sparseStorage[reg].emplace(std::move(value));
+    };
+    
+    ThreadPool& pool = ThreadPool::getInstance();
+    const double coef = instruction.scale >= 0 ? instruction.constant * scalar(instruction.scale)
+                                               : instruction.constant;
+    const bool transposeLhs = (instruction.aux & Instruction::TRANSPOSE_LHS) != 0;
+    const bool transposeRhs = (instruction.aux & Instruction::TRANSPOSE_RHS) != 0;
+    
+    switch (instruction.op) {
+        case OpCode::LoadConstant:
+            scalar(instruction.dst) = instruction.constant;
+            return;
+        
+        case OpCode::ScalarNegate:
+            scalar(instruction.dst) = -scalar(instruction.a);
+            return;
+        
+        case OpCode::ScalarBinary:
+            scalar(instruction.dst) = applyScalarOperator(static_cast<BinaryOp>(instruction.aux),
+                                                          scalar(instruction.a), scalar(instruction.b));
+            return;
+        
+        case OpCode::ScalarFunction:
+            scalar(instruction.dst) = applyScalarFunction(static_cast<FunctionId>(instruction.aux),
+                                                          scalar(instruction.a));
+            return;
+        
+        case OpCode::ScalarFallback: {
+            const std::string& source = program.sources[instruction.aux];
+            const Value value = variables_.evaluate(source);
+            if (!value.isScalar()) {
+                throw std::runtime_error("Expression scalaire attendue : " + source);
+            }
+            scalar(instruction.dst) = value.toDouble();
+            return;
+        }
+        
+        case OpCode::Dot: {
+            ConstMatrixMap a = in(instruction.a);
+            ConstMatrixMap b = in(instruction.b);
+            scalar(instruction.dst) = pool.parallelSum(a.size(), [&](Eigen::Index begin, Eigen::Index end) {
+                return a.col(0).segment(begin, end - begin).dot(b.col(0).segment(begin, end - begin));
+            });
+            return;
+        }
+        
+        case OpCode::Reduce: {
+            if (program.registers[instruction.a].type == ValueKind::Sparse) {
+                scalar(instruction.dst) = reduceSparse(*frame.sparse[instruction.a], static_cast<FunctionId>(instruction.aux));
+                return;
+            }
+            ConstMatrixMap data = in(instruction.a);
+            auto elements = Eigen::Map<const Eigen::VectorXd>(data.data(), data.size());
+            double& dst = scalar(instruction.dst);
+            switch (static_cast<FunctionId>(instruction.aux)) {
+                case FunctionId::Det: {
+                    std::optional<Eigen::PartialPivLU<Eigen::MatrixXd>> local;
+                    dst = luOf(program, frame, instruction.a, local).determinant();
+                    return;
+                }
+                case FunctionId::Trace:
+                    dst = data.trace();
+                    return;
+                case FunctionId::Norm:
+                    dst = std::sqrt(pool.parallelSum(elements.size(), [&](Eigen::Index begin, Eigen::Index end) {
+                        return elements.segment(begin, end - begin).squaredNorm();
+                    }));
+                    return;
+                case FunctionId::Sum:
+                    dst = pool.parallelSum(elements.size(), [&](Eigen::Index begin, Eigen::Index end) {
+                        return elements.segment(begin, end - begin).sum();
+                    });
+                    return;
+                case FunctionId::Nnz:
+                    dst = pool.parallelSum(elements.size(), [&](Eigen::Index begin, Eigen::Index end) {
+                        return static_cast<double>((elements.segment(begin, end - begin).array() != 0.0).count());
+                    });
+                    return;
+                default:
+                    throw std::runtime_error("Réduction non supportée");
+            }
+        }
+        
+        case OpCode::LoadElement:
+            scalar(instruction.dst) = frame.data[instruction.a][elementOffset(program, instruction, instruction.a)];
+            return;
+        
+        case OpCode::Fill:
+            out(instruction.dst).setConstant(coef);
+            return;
+        
+        case OpCode::AddConstant:
+            out(instruction.dst).array() += coef;
+            return;
+        
+        case OpCode::Scale: {
+            MatrixOut dst = out(instruction.dst);
+            ConstMatrixMap a = in(instruction.a);
+            if (transposeLhs) {
+                dst.noalias() = coef * a.transpose();
+            } else if (coef == 1.0) {
+                dst = a;
+            } else {
+                dst.noalias() = coef * a;
+            }
+            return;
+        }
+        
+        case OpCode::AddScaled: {
+            MatrixOut dst = out(instruction.dst);
+            ConstMatrixMap a = in(instruction.a);
+            if (transposeLhs) {
+                dst.noalias() += coef * a.transpose();
+            } else {
+                dst.noalias() += coef * a;
+            }
+            return;
+        }
+        
+        case OpCode::ScaleInPlace:
+            out(instruction.dst) *= coef;
+            return;
+        
+        case OpCode::Transpose:
+            out(instruction.dst).noalias() = in(instruction.a).transpose();
+            return;
+        
+        case OpCode::Slice: {
+            // Lignes et colonnes espacées de leur pas dans le registre source
+            using Stride = Eigen::Stride<Eigen::Dynamic, Eigen::Dynamic>;
+            const SliceInfo& slice = program.slices[instruction.aux];
+            const Eigen::Index sourceRows = program.registers[instruction.a].rows;
+            Eigen::Map<const Eigen::MatrixXd, 0, Stride> elements(
+                frame.data[instruction.a] + slice.cols.first * sourceRows + slice.rows.first,
+                slice.rows.size, slice.cols.size, Stride(sourceRows * slice.cols.step, slice.rows.step));
+            out(instruction.dst) = elements;
+            return;
+        }
+        
+        case OpCode::Gemm: {
+            ConstMatrixMap a = in(instruction.a);
+            ConstMatrixMap b = in(instruction.b);
+            const bool accumulate = (instruction.aux & Instruction::ACCUMULATE) != 0;
+            MatrixOut dst = out(instruction.dst);
+            if (transposeLhs && transposeRhs) {
+                pool.multiply(dst, a.transpose(), b.transpose(), coef, accumulate);
+            } else if (transposeLhs) {
+                pool.multiply(dst, a.transpose(), b, coef, accumulate);
+            } else if (transposeRhs) {
+                pool.multiply(dst, a, b.transpose(), coef, accumulate);
+            } else {
+                pool.multiply(dst, a, b, coef, accumulate);
+            }
+            return;
+        }
+        
+        case OpCode::Solve: {
+            // Carrée : LU, sinon moindres carrés par QR. Les décompositions
+            // d'une variable sont conservées : O(n²) par second membre.
+            ConstMatrixMap b = in(instruction.b);
+            MatrixOut dst = out(instruction.dst);
+            const RegisterInfo& lhs = program.registers[instruction.a];
+            if (lhs.rows == lhs.cols) {
+                std::optional<Eigen::PartialPivLU<Eigen::MatrixXd>> local;
+                dst = invertibleLuOf(program, frame, instruction.a, local).solve(b);
+            } else {
+                std::optional<Eigen::ColPivHouseholderQR<Eigen::MatrixXd>> local;
+                dst = qrOf(program, frame, instruction.a, local).solve(b);
+            }
+            return;
+        }
+        
+        case OpCode::Inverse: {
+            std::optional<Eigen::PartialPivLU<Eigen::MatrixXd>> local;
+            out(instruction.dst) = invertibleLuOf(program, frame, instruction.a, local).inverse();
+            return;
+        }
+        
+        case OpCode::MatrixPower: {
+            double exponent = scalar(instruction.b);
+            if (exponent != std::floor(exponent)) {
+                throw std::runtime_error("L'exposant d'une puissance matricielle doit être entier");
+            }
+            long long k = static_cast<long long>(exponent);
+            std::optional<Eigen::PartialPivLU<Eigen::MatrixXd>> local;
+            Eigen::MatrixXd base = k < 0 ? invertibleLuOf(program, frame, instruction.a, local).inverse()
+                                         : Eigen::MatrixXd(in(instruction.a));
+            k = k < 0 ? -k : k;
+            
+            // Exponentiation rapide
+            MatrixOut dst = out(instruction.dst);
+            dst.setIdentity();
+            Eigen::MatrixXd product(base.rows(), base.cols());
+            while (k > 0) {
+                if (k & 1) {
+                    pool.multiply(product, dst, base, 1.0, false);
+                    dst = product;
+                }
+                k >>= 1;
+                if (k > 0) {
+                    pool.multiply(product, base, base, 1.0, false);
+                    base.swap(product);
+                }
+            }
+            return;
+        }
+        
+        case OpCode::Fused: {
+            const FusedKernel& kernel = program.kernels[instruction.aux];
+            frame.inputs.resize(kernel.inputs.size());
+            frame.scalars.resize(kernel.scalars.size());
+            for (size_t i = 0; i < kernel.inputs.size(); ++i) {
+                frame.inputs[i] = frame.data[kernel.inputs[i]];
+            }
+            for (size_t i = 0; i < kernel.scalars.size(); ++i) {
+                frame.scalars[i] = scalar(kernel.scalars[i]);
+            }
+            MatrixOut dst = out(instruction.dst);
+            kernel.program.run(frame.inputs.data(), frame.scalars.data(), dst.data(), dst.size());
+            return;
+        }
+        
+        case OpCode::LoadLiteral:
+            out(instruction.dst) = program.literals[instruction.aux];
+            return;
+        
+        case OpCode::SetElement:
+            frame.data[instruction.dst][elementOffset(program, instruction, instruction.dst)] = scalar(instruction.a);
+            return;
+        
+        case OpCode::SparseFromDense:
+            setSparse(instruction.dst, SparseMatrix(in(instruction.a)));
+            return;
+        
+        case OpCode::SparseFromTriplets: {
+            const RegisterInfo& dst = program.registers[instruction.dst];
+            std::vector<SparseMatrix::Triplet> triplets;
+            if (instruction.a >= 0) {
+                triplets = gatherTriplets(frame.data[instruction.a], frame.data[instruction.b], frame.data[instruction.aux],
+                                          program.registers[instruction.a].rows, program.registers[instruction.b].rows,
+                                          program.registers[instruction.aux].rows);
+            }
+            setSparse(instruction.dst, SparseMatrix(dst.rows, dst.cols, triplets));
+            return;
+        }
+        
+        case OpCode::SparseToDense:
+            out(instruction.dst) = frame.sparse[instruction.a]->getData().toDense();
+            return;
+        
+        case OpCode::SparseScale: {
+            const SparseMatrix::Storage& a = frame.sparse[instruction.a]->getData();
+            SparseMatrix::Storage result = transposeLhs ? SparseMatrix::Storage(a.transpose()) : a;
+            if (coef != 1.0) {
+                result *= coef;
+            }
+            setSparse(instruction.dst, SparseMatrix(std::move(result)));
+            return;
+        }
+        
+        case OpCode::SparseBinary: {
+            const SparseMatrix& a = *frame.sparse[instruction.a];
+            const SparseMatrix& b = *frame.sparse[instruction.b];
+            switch (static_cast<BinaryOp>(instruction.aux)) {
+                case BinaryOp::Add:
+                    setSparse(instruction.dst, a + b);
+                    return;
+                case BinaryOp::Sub:
+                    setSparse(instruction.dst, a - b);
+                    return;
+                case BinaryOp::Mul:
+                    setSparse(instruction.dst, a * b);
+                    return;
+                default:
+                    throw std::runtime_error("Opération creuse non supportée");
+            }
+        }
+        
+        case OpCode::SparseAddTo:
+            out(instruction.dst) += coef * frame.sparse[instruction.a]->getData();
+            return;
+        
+        case OpCode::SparseProduct: {
+            // Un seul des deux opérandes est creux : produit creux-dense d'Eigen
+            const bool accumulate = (instruction.aux & Instruction::ACCUMULATE) != 0;
+            MatrixOut dst = out(instruction.dst);
+            auto apply = [&](const auto& lhs, const auto& rhs) {
+                if (accumulate) {
+                    dst.noalias() += coef * (lhs * rhs);
+                } else {
+                    dst.noalias() = coef * (lhs * rhs);
+                }
+            };
+            if (program.registers[instruction.a].type == ValueKind::Sparse) {
+                const SparseMatrix::Storage& a = frame.sparse[instruction.a]->getData();
+                ConstMatrixMap b = in(instruction.b);
+                if (transposeLhs && transposeRhs) {
+                    apply(a.transpose(), b.transpose());
+                } else if (transposeLhs) {
+                    apply(a.transpose(), b);
+                } else if (transposeRhs) {
+                    apply(a, b.transpose());
+                } else {
+                    apply(a, b);
+                }
+            } else {
+                ConstMatrixMap a = in(instruction.a);
+                const SparseMatrix::Storage& b = frame.sparse[instruction.b]->getData();
+                if (transposeLhs && transposeRhs) {
+                    apply(a.transpose(), b.transpose());
+                } else if (transposeLhs) {
+                    apply(a.transpose(), b);
+                } else if (transposeRhs) {
+                    apply(a, b.transpose());
+                } else {
+                    apply(a, b);
+                }
+            }
+            return;
+        }
+        
+        case OpCode::SparseSolve: {
+            // Décompositions directes conservées par la valeur : O(nnz) par second membre
+            const SolverInfo& solver = program.solvers[instruction.aux];
+            const SparseMatrix& a = *frame.sparse[instruction.a];
+            ConstMatrixMap b = in(instruction.b);
+            if (!solver.iterative) {
+                out(instruction.dst) = a.solve(b);
+                return;
+            }
+            const double tolerance = solver.tolerance >= 0 ? scalar(solver.tolerance) : SolverInfo::DEFAULT_TOLERANCE;
+            const auto iterations = solver.iterations >= 0 ? SparseMatrix::iterationLimit(scalar(solver.iterations)) : 0;
+            out(instruction.dst) = a.solveIterative(solver.method, b.col(0), tolerance, iterations);
+            return;
+        }
+    }
+}
+
+const Eigen::PartialPivLU<Eigen::MatrixXd>& VirtualMachine::luOf(
+    const Program& program, Frame& frame, int reg, std::optional<Eigen::PartialPivLU<Eigen::MatrixXd>>& local) {
+    if (const Matrix* matrix = matrixVariable(program, frame, reg)) {
+        return matrix->lu();
+    }
+    const RegisterInfo& info = program.registers[reg];
+    return local.emplace(ConstMatrixMap(frame.data[reg], info.rows, info.cols));
+}
+
+const Eigen::PartialPivLU<Eigen::MatrixXd>& VirtualMachine::invertibleLuOf(
+    const Program& program, Frame& frame, int reg, std::optional<Eigen::PartialPivLU<Eigen::MatrixXd>>& local) {
+    const Matrix* matrix = matrixVariable(program, frame, reg);
+    const auto& lu = luOf(program, frame, reg, local);
+    if (matrix) {
+        matrix->requireInvertible();
+    } else {
+        Matrix::requireInvertible(lu);
+    }
+    return lu;
+}
+
+const Eigen::ColPivHouseholderQR<Eigen::MatrixXd>& VirtualMachine::qrOf(
+    const Program& program, Frame& frame, int reg, std::optional<Eigen::ColPivHouseholderQR<Eigen::MatrixXd>>& local) {
+    if (const Matrix* matrix = matrixVariable(program, frame, reg)) {
+        return matrix->qr();
+    }
+    const RegisterInfo& info = program.registers[reg];
+    return local.emplace(ConstMatrixMap(frame.data[reg], info.rows, info.cols));
+}
+
+const Matrix* VirtualMachine::matrixVariable(const Program& program, const Frame& frame, int reg) const {
+    const RegisterInfo& info = program.registers[reg];
+    if (info.storage != RegisterStorage::Variable || info.type != ValueKind::Matrix) {
+        return nullptr;
+    }
+    return frame.bound[info.variable]->getIf<Matrix>();
+}
+
+} // namespace FusioCore
@@ -0,0 +1,330 @@
+#include "IO/CsvReader.hpp"
+#include "IO/MappedFile.hpp"
+#include "Runtime/ThreadPool.hpp"
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+namespace FusioCore {
+
+namespace {
+
+// Ligne [begin, end), sans fin de ligne ; next pointe sur la ligne suivante
+struct Line {
+    const char* begin;
+    const char* end;
+    const char* next;
+};
+
+Line nextLine(const char* position, const char* end) {
+    const auto* newline = static_cast<const char*>(std::memchr(position, '\n', static_cast<size_t>(end - position)));
+    Line line{position, newline ? newline : end, newline ? newline + 1 : end};
+    if (line.end > line.begin && line.end[-1] == '\r') {
+        --line.end;
+    }
+    return line;
+}
+
+const char* findDelimiter(const char* begin, const char* end, char delimiter) {
+    const auto* found = static_cast<const char*>(std::memchr(begin, delimiter, static_cast<size_t>(end - begin)));
+    return found ? found : end;
+}
+
+Eigen::Index countFields(const Line& line, char delimiter) {
+    return static_cast<Eigen::Index>(std::count(line.begin, line.end, delimiter)) + 1;
+}
+
+// Séparateur le plus fréquent de la première ligne (virgule par défaut)
+char detectDelimiter(const Line& line) {
+    char best = ',';
+    std::ptrdiff_t bestCount = 0;
+    for (char candidate : {',', '\t', ';'}) {
+        std::ptrdiff_t count = std::count(line.begin, line.end, candidate);
+        if (count > bestCount) {
+            best = candidate;
+            bestCount = count;
+        }
+    }
+    return best;
+}
+
+bool isMissing(std::string_view field) {
+    static constexpr std::string_view MARKERS[] = {"na", "n/a", "null", "none"};
+    for (std::string_view marker : MARKERS) {
+        if (field.size() == marker.size() &&
+            std::equal(field.begin(), field.end(), marker.begin(), [](char a, char b) {
+                return std::tolower(static_cast<unsigned char>(a)) == b;
+            })) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Puissances de dix représentées exactement par un double
+constexpr double EXACT_POWERS_OF_TEN[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7,
+                                          1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15};
+
+// Décimal court ([-]chiffres[.chiffres], au plus 15 chiffres, sans exposant) :
+// la mantisse entière et la puissance de dix sont exactes, leur quotient est
+// donc correctement arrondi, comme par from_chars, pour bien moins cher.
+// Retourne la fin du nombre, nullptr s'il ne relève pas de ce cas.
+const char* parseDecimal(const char* begin, const char* end, double& value) {
+    const char* position = begin;
+    const bool negative = position < end && *position == '-';
+    if (negative) {
+        ++position;
+    }
+    uint64_t mantissa = 0;
+    int digits = 0;
+    int decimals = 0;
+    while (position < end && static_cast<unsigned char>(*position - '0') < 10) {
+        mantissa = mantissa * 10 + static_cast<uint64_t>(*position - '0');
+        ++digits;
+        ++position;
+    }
+    if (position < end && *position == '.') {
+        ++position;
+        while (position < end && static_cast<unsigned char>(*position - '0') < 10) {
+            mantissa = mantissa * 10 + static_cast<uint64_t>(*position - '0');
+            ++digits;
+            ++decimals;
+            ++position;
+        }
+    }
+    if (digits == 0 || digits > 15 || (position < end && (*position == 'e' || *position == 'E'))) {
+        return nullptr;
+    }
+    const double magnitude = static_cast<double>(mantissa) / EXACT_POWERS_OF_TEN[decimals];
+    value = negative ? -magnitude : magnitude;
+    return position;
+}
+
+// Analyse un champ ; false s'il n'est ni un nombre ni une valeur manquante
+bool parseField(const char* begin, const char* end, double& value) {
+    while (begin < end && (*begin == ' ' || *begin == '\t')) {
+        ++begin;
+    }
+    while (end > begin && (end[-1] == ' ' || end[-1] == '\t')) {
+        --end;
+    }
+    if (end - begin >= 2 && *begin == '"' && end[-1] == '"') {
+        ++begin;
+        --end;
+    }
+    if (begin == end) {
+        value = std::numeric_limits<double>::quiet_NaN();
+        return true;
+    }
+    
+    // from_chars refuse le signe '+'
+    const char* number = begin;
+    if (*number == '+' && end - number > 1 && number[1] != '-' && number[1] != '+') {
+        ++number;
+    }
+    auto [last, error] = std::from_chars(number, end, value);
+    if (last == end && error == std::errc()) {
+        return true;
+    }
+    if (last == end && error == std::errc::result_out_of_range) {
+        // Dépassement : infini ou zéro, comme strtod
+        value = std::strtod(std::string(begin, end).c_str(), nullptr);
+        return true;
+    }
+    if (isMissing(std::string_view(begin, static_cast<size_t>(end - begin)))) {
+        value = std::numeric_limits<double>::quiet_NaN();
+        return true;
+    }
+    return false;
+}
+
+// Une ligne d'en-tête contient au moins un champ non numérique
+bool isHeader(const Line& line, char delimiter) {
+    const char* field = line.begin;
+    while (true) {
+        const char* fieldEnd = findDelimiter(field, line.end, delimiter);
+        double value;
+        if (!parseField(field, fieldEnd, value)) {
+            return true;
+        }
+        if (fieldEnd == line.end) {
+            return false;
+        }
+        field = fieldEnd + 1;
+    }
+}
+
+// Bloc de lignes analysé par un même thread
+struct Chunk {
+    const char* begin = nullptr;
+    const char* end = nullptr;
+    Eigen::Index rows = 0;      // Lignes non vides
+    size_t lines = 0;           // Lignes du fichier, vides comprises
+    Eigen::Index firstRow = 0;  // Ligne de la matrice du début du bloc
+    size_t firstLine = 0;       // Lignes du fichier qui précèdent le bloc
+    std::string error;
+};
+
+void countLines(Chunk& chunk) {
+    for (const char* position = chunk.begin; position < chunk.end;) {
+        Line line = nextLine(position, chunk.end);
+        ++chunk.lines;
+        if (line.begin != line.end) {
+            ++chunk.rows;
+        }
+        position = line.next;
+    }
+}
+
+void parseChunk(Chunk& chunk, char delimiter, Eigen::MatrixXd& data) {
+    const Eigen::Index cols = data.cols();
+    const Eigen::Index stride = data.rows();
+    double* row = data.data() + chunk.firstRow;
+    size_t lineNumber = chunk.firstLine;
+    
+    for (const char* position = chunk.begin; position < chunk.end;) {
+        Line line = nextLine(position, chunk.end);
+        position = line.next;
+        ++lineNumber;
+        if (line.begin == line.end) {
+            continue;
+        }
+        
+        const char* field = line.begin;
+        for (Eigen::Index j = 0; j < cols; ++j) {
+            // Cas courant : un nombre nu, directement suivi du séparateur
+            const char* numberEnd = parseDecimal(field, line.end, row[j * stride]);
+            if (numberEnd) {
+                const bool last = j + 1 == cols;
+                if (numberEnd == line.end && last) {
+                    break;
+                }
+                if (numberEnd < line.end && *numberEnd == delimiter && !last) {
+                    field = numberEnd + 1;
+                    continue;
+                }
+            }
+            
+            const char* fieldEnd = findDelimiter(field, line.end, delimiter);
+            const bool last = j + 1 == cols;
+            if (last != (fieldEnd == line.end)) {
+                chunk.error = "Ligne " + std::to_string(lineNumber) + " : " +
+                              std::to_string(countFields(line, delimiter)) + " champ(s) au lieu de " +
+                              std::to_string(cols);
+                return;
+            }
+            if (!parseField(field, fieldEnd, row[j * stride])) {
+                chunk.error = "Ligne " + std::to_string(lineNumber) + ", colonne " + std::to_string(j + 1) +
+                              " : valeur non numérique \"" + std::string(field, fieldEnd) + "\"";
+                return;
+            }
+            field = fieldEnd + 1;
+        }
+        ++row;
+    }
+}
+
+} // namespace
+
+double CsvStats::throughput() const {
+    return seconds > 0.0 ? static_cast<double>(bytes) / seconds : 0.0;
+}
+
+Matrix CsvReader::read(const std::string& path, CsvStats& stats) {
+    const auto start = std::chrono::steady_clock::now();
+    MappedFile file(path);
+    const char* begin = file.data();
+    const char* const end = begin + file.size();
+    stats = CsvStats();
+    stats.bytes = file.size();
+    
+    // Marque d'ordre des octets UTF-8
+    if (file.size() >= 3 && std::memcmp(begin, "\xEF\xBB\xBF", 3) == 0) {
+        begin += 3;
+    }
+    
+    // Première ligne non vide : séparateur, nombre de colonnes et en-tête
+    size_t skippedLines = 0;
+    Line first{end, end, end};
+    while (begin < end) {
+        Line line = nextLine(begin, end);
+        if (line.begin != line.end) {
+            first = line;
+            break;
+        }
+        ++skippedLines;
+        begin = line.next;
+    }
+    Matrix matrix;
+    if (first.begin == end) {
+        stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        return matrix;
+    }
+    const char delimiter = detectDelimiter(first);
+    const Eigen::Index cols = countFields(first, delimiter);
+    stats.header = isHeader(first, delimiter);
+    if (stats.header) {
+        ++skippedLines;
+        begin = first.next;
+    }
+    
+    // Découpage en blocs terminés par une fin de ligne
+    std::vector<Chunk> chunks;
+    for (const char* position = begin; position < end;) {
+        Chunk chunk;
+        chunk.begin = position;
+        const char* target = static_cast<size_t>(end - position) > CHUNK_SIZE ? position + CHUNK_SIZE : end;
+        chunk.end = target == end ? end : nextLine(target, end).next;
+        position = chunk.end;
+        chunks.push_back(chunk);
+    }
+    
+    auto& pool = ThreadPool::getInstance();
+    const auto chunkCount = static_cast<Eigen::Index>(chunks.size());
+    pool.parallelFor(chunkCount, 1, [&](Eigen::Index from, Eigen::Index to) {
+        for (Eigen::Index k = from; k < to; ++k) {
+            countLines(chunks[k]);
+        }
+    });
+    
+    Eigen::Index rows = 0;
+    size_t lines = skippedLines;
+    for (Chunk& chunk : chunks) {
+        chunk.firstRow = rows;
+        chunk.firstLine = lines;
+        rows += chunk.rows;
+        lines += chunk.lines;
+    }
+    
+    // Allocation unique, sans initialisation : chaque élément est écrit par l'analyse
+    Eigen::MatrixXd& data = matrix.getData();
+    data.resize(rows, cols);
+    pool.parallelFor(chunkCount, 1, [&](Eigen::Index from, Eigen::Index to) {
+        for (Eigen::Index k = from; k < to; ++k) {
+            parseChunk(chunks[k], delimiter, data);
+        }
+    });
+    
+    // Première erreur dans l'ordre du fichier
+    for (const Chunk& chunk : chunks) {
+        if (!chunk.error.empty()) {
+            throw std::runtime_error(chunk.error + " : " + path);
+        }
+    }
+    
+    stats.rows = rows;
+    stats.cols = cols;
+    stats.threads = std::min(pool.getThreadCount(), std::max<size_t>(chunks.size(), 1));
+    stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return matrix;
+}
+
+} // namespace FusioCore
@@ -0,0 +1,82 @@
+#include "IO/MappedFile.hpp"
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+#ifdef _WIN32
+#include <fstream>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace FusioCore {
+
+#ifdef _WIN32
+
+MappedFile::MappedFile(const std::string& path) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+        throw std::runtime_error("Impossible d'ouvrir le fichier : " + path);
+    }
+    buffer_.resize(static_cast<size_t>(file.tellg()));
+    file.seekg(0);
+    if (!file.read(buffer_.data(), static_cast<std::streamsize>(buffer_.size()))) {
+        throw std::runtime_error("Impossible de lire le fichier : " + path);
+    }
+    data_ = buffer_.data();
+    size_ = buffer_.size();
+}
+
+MappedFile::~MappedFile() = default;
+
+#else
+
+MappedFile::MappedFile(const std::string& path) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("Impossible d'ouvrir le fichier : " + path + " (" + std::strerror(errno) + ")");
+    }
+    
+    struct stat info;
+    if (::fstat(fd, &info) != 0) {
+        int error = errno;
+        ::close(fd);
+        throw std::runtime_error("Impossible de lire le fichier : " + path + " (" + std::strerror(error) + ")");
+    }
+    size_ = static_cast<size_t>(info.st_size);
+    
+    if (size_ > 0) {
+        // Lecture seule : les pages ne sont pas comptées dans la mémoire engagée, un
+        // fichier plus grand que la mémoire se projette ; les valeurs copient avant d'écrire
+        void* address = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (address == MAP_FAILED) {
+            int error = errno;
+            ::close(fd);
+            throw std::runtime_error("Impossible de projeter le fichier : " + path + " (" + std::strerror(error) + ")");
+        }
+        data_ = static_cast<char*>(address);
+    }
+    // La projection reste valide après la fermeture du descripteur
+    ::close(fd);
+}
+
+MappedFile::~MappedFile() {
+    if (data_) {
+        ::munmap(data_, size_);
+    }
+}
+
+#endif
+
+const char* MappedFile::data() const {
+    return data_;
+}
+
+size_t MappedFile::size() const {
+    return size_;
+}
+
+} // namespace FusioCore
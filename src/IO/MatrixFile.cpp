@@ -0,0 +1,224 @@
+#include "IO/MatrixFile.hpp"
+#include "IO/MappedFile.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace FusioCore {
+
+namespace {
+
+constexpr char MAGIC[8] = {'F', 'U', 'S', 'I', 'O', 'M', 'A', 'T'};
+constexpr size_t HEADER_SIZE = 64;
+
+// Types des éléments
+constexpr uint32_t DTYPE_FLOAT64 = 1;
+constexpr uint32_t DTYPE_FLOAT32 = 2;
+constexpr uint32_t DTYPE_INT32 = 3;
+constexpr uint32_t DTYPE_INT64 = 4;
+
+// Nature de la valeur enregistrée
+constexpr uint32_t KIND_SCALAR = 0;
+constexpr uint32_t KIND_VECTOR = 1;
+constexpr uint32_t KIND_MATRIX = 2;
+
+// Positions des champs de l'en-tête
+constexpr size_t OFFSET_VERSION = 8;
+constexpr size_t OFFSET_DTYPE = 12;
+constexpr size_t OFFSET_KIND = 16;
+constexpr size_t OFFSET_ROWS = 24;
+constexpr size_t OFFSET_COLS = 32;
+constexpr size_t OFFSET_PAYLOAD = 40;
+
+// Position du contenu : premier multiple de l'alignement après l'en-tête
+constexpr uint64_t PAYLOAD_OFFSET = (HEADER_SIZE + MatrixFile::ALIGNMENT - 1) / MatrixFile::ALIGNMENT *
+                                    MatrixFile::ALIGNMENT;
+
+template <typename T>
+void put(char* header, size_t offset, T value) {
+    std::memcpy(header + offset, &value, sizeof(T));
+}
+
+template <typename T>
+T get(const char* header, size_t offset) {
+    T value;
+    std::memcpy(&value, header + offset, sizeof(T));
+    return value;
+}
+
+size_t elementSize(DType dtype) {
+    return dispatch(dtype, [](auto tag) {
+        return sizeof(typename decltype(tag)::type);
+    });
+}
+
+} // namespace
+
+uint32_t MatrixFile::dtypeCode(DType dtype) {
+    switch (dtype) {
+        case DType::F32: return DTYPE_FLOAT32;
+        case DType::I32: return DTYPE_INT32;
+        case DType::I64: return DTYPE_INT64;
+        case DType::F64: break;
+    }
+    return DTYPE_FLOAT64;
+}
+
+void MatrixFile::requireLittleEndian(const std::string& feature) {
+    const uint16_t probe = 1;
+    unsigned char first = 0;
+    std::memcpy(&first, &probe, 1);
+    if (first != 1) {
+        throw std::runtime_error(feature + " non supporté sur une architecture gros-boutiste");
+    }
+}
+
+void MatrixFile::save(const std::string& path, const Value& value) {
+    requireLittleEndian("Format .fmat");
+    
+    // Éléments à écrire, contigus en ordre colonne, dans leur type
+    uint32_t kind = KIND_MATRIX;
+    DType dtype = DType::F64;
+    double scalar = 0.0;
+    const void* elements = &scalar;
+    Eigen::Index rows = 1;
+    Eigen::Index cols = 1;
+    Matrix matrix;  // Copie partagée de la matrice enregistrée, rendue contiguë
+    switch (value.kind()) {
+        case ValueKind::Scalar:
+            kind = KIND_SCALAR;
+            scalar = value.toDouble();
+            break;
+        case ValueKind::Vector: {
+            const Vector& vector = value.as<Vector>();
+            kind = KIND_VECTOR;
+            dtype = vector.dtype();
+            rows = static_cast<Eigen::Index>(vector.size());
+            elements = dispatch(dtype, [&](auto tag) -> const void* {
+                return vector.getTypedData<typename decltype(tag)::type>().data();
+            });
+            break;
+        }
+        case ValueKind::Matrix:
+            // Une vue transposée ou sur des lignes est copiée une fois
+            matrix = value.as<Matrix>();
+            matrix.materialize();
+            dtype = matrix.dtype();
+            rows = static_cast<Eigen::Index>(matrix.rows());
+            cols = static_cast<Eigen::Index>(matrix.cols());
+            elements = dispatch(dtype, [&](auto tag) -> const void* {
+                return matrix.getTypedData<typename decltype(tag)::type>().data();
+            });
+            break;
+        case ValueKind::Sparse:
+            throw std::runtime_error("Type de valeur non supporté pour l'enregistrement");
+    }
+    
+    char header[HEADER_SIZE] = {};
+    std::memcpy(header, MAGIC, sizeof(MAGIC));
+    put<uint32_t>(header, OFFSET_VERSION, VERSION);
+    put<uint32_t>(header, OFFSET_DTYPE, dtypeCode(dtype));
+    put<uint32_t>(header, OFFSET_KIND, kind);
+    put<uint64_t>(header, OFFSET_ROWS, static_cast<uint64_t>(rows));
+    put<uint64_t>(header, OFFSET_COLS, static_cast<uint64_t>(cols));
+    put<uint64_t>(header, OFFSET_PAYLOAD, PAYLOAD_OFFSET);
+    
+    // Écriture à côté puis renommage : les projections de l'ancien fichier restent intactes
+    const std::string temporary = path + ".tmp";
+    {
+        std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            throw std::runtime_error("Impossible d'écrire le fichier : " + path);
+        }
+        file.write(header, HEADER_SIZE);
+        const std::vector<char> padding(PAYLOAD_OFFSET - HEADER_SIZE, 0);
+        file.write(padding.data(), static_cast<std::streamsize>(padding.size()));
+        
+        file.write(static_cast<const char*>(elements),
+                   static_cast<std::streamsize>(rows * cols * static_cast<Eigen::Index>(elementSize(dtype))));
+        file.close();
+        if (!file) {
+            std::remove(temporary.c_str());
+            throw std::runtime_error("Impossible d'écrire le fichier : " + path);
+        }
+    }
+#ifdef _WIN32
+    std::remove(path.c_str());
+#endif
+    if (std::rename(temporary.c_str(), path.c_str()) != 0) {
+        std::remove(temporary.c_str());
+        throw std::runtime_error("Impossible d'écrire le fichier : " + path);
+    }
+}
+
+Value MatrixFile::load(const std::string& path) {
+    requireLittleEndian("Format .fmat");
+    auto file = std::make_shared<const MappedFile>(path);
+    const char* header = file->data();
+    
+    if (file->size() < HEADER_SIZE || std::memcmp(header, MAGIC, sizeof(MAGIC)) != 0) {
+        throw std::runtime_error("Fichier .fmat invalide : " + path);
+    }
+    const auto version = get<uint32_t>(header, OFFSET_VERSION);
+    if (version != VERSION) {
+        throw std::runtime_error("Version de fichier .fmat non supportée (" + std::to_string(version) + ") : " + path);
+    }
+    DType dtype = DType::F64;
+    switch (const auto code = get<uint32_t>(header, OFFSET_DTYPE)) {
+        case DTYPE_FLOAT64: dtype = DType::F64; break;
+        case DTYPE_FLOAT32: dtype = DType::F32; break;
+        case DTYPE_INT32: dtype = DType::I32; break;
+        case DTYPE_INT64: dtype = DType::I64; break;
+        default:
+            throw std::runtime_error("Type d'élément non supporté (" + std::to_string(code) + ") : " + path);
+    }
+    
+    const auto kind = get<uint32_t>(header, OFFSET_KIND);
+    const auto rows = get<uint64_t>(header, OFFSET_ROWS);
+    const auto cols = get<uint64_t>(header, OFFSET_COLS);
+    const auto offset = get<uint64_t>(header, OFFSET_PAYLOAD);
+    
+    const uint64_t maxIndex = static_cast<uint64_t>(std::numeric_limits<Eigen::Index>::max());
+    const bool shapeValid = (kind == KIND_SCALAR && rows == 1 && cols == 1 && dtype == DType::F64) ||
+                            (kind == KIND_VECTOR && cols == 1) || kind == KIND_MATRIX;
+    if (!shapeValid || rows > maxIndex || cols > maxIndex ||
+        offset < HEADER_SIZE || offset % ALIGNMENT != 0) {
+        throw std::runtime_error("Fichier .fmat invalide : " + path);
+    }
+    
+    // Taille du contenu, sans débordement
+    const uint64_t available = file->size() - std::min<uint64_t>(offset, file->size());
+    const uint64_t capacity = available / elementSize(dtype);
+    if (cols != 0 && rows > capacity / cols) {
+        throw std::runtime_error("Fichier .fmat tronqué : " + path);
+    }
+    
+    const auto rowCount = static_cast<Eigen::Index>(rows);
+    const auto colCount = static_cast<Eigen::Index>(cols);
+    return dispatch(dtype, [&](auto tag) -> Value {
+        using T = typename decltype(tag)::type;
+        const auto* payload = reinterpret_cast<const T*>(header + offset);
+        switch (kind) {
+            case KIND_SCALAR:
+                return Scalar(static_cast<double>(payload[0]));
+            case KIND_VECTOR:
+                if (rows == 0) {
+                    return Vector(VectorOf<T>());
+                }
+                // Le vecteur garde la projection en vie
+                return Vector(payload, rowCount, file);
+            default:
+                if (rows == 0 || cols == 0) {
+                    return Matrix(MatrixOf<T>(rowCount, colCount));
+                }
+                // La matrice garde la projection en vie
+                return Matrix(payload, rowCount, colCount, file);
+        }
+    });
+}
+
+} // namespace FusioCore
@@ -1,14 +1,173 @@
 #include "Expression/FusioInterpreter.hpp"
 #include "Shell/Shell.hpp"
-#include "Value/Value.hpp"
+#include "Shell/BatchShell.hpp"
+#include "Value/ValueFormatter.hpp"
+#include "Value/Variant.hpp"
+#include "Value/Warnings.hpp"
 #include "Expression/ExpressionEvaluatorFactory.hpp"
+#include "Runtime/ThreadPool.hpp"
+#include "Server/EvaluationServer.hpp"
 
+#include <cctype>
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
 #include <iostream>
+#include <sstream>
 #include <string>
 
-int main() {
+#ifdef _WIN32
+#include <io.h>
+#define FUSIO_ISATTY _isatty
+#define FUSIO_FILENO _fileno
+#else
+#include <unistd.h>
+#define FUSIO_ISATTY isatty
+#define FUSIO_FILENO fileno
+#endif
+
+namespace {
+
+/**
+ * Affiche les avertissements de la dernière évaluation
+ * @param prefix Début de chaque message ("Avertissement", suivi du numéro de ligne en mode script)
+ */
+void printWarnings(FusioCore::IShell& shell, const std::string& prefix) {
+    for (const std::string& warning : FusioCore::Warnings::take()) {
+        shell.print(prefix + " : " + warning, FusioCore::ShellType::WARNING);
+    }
+}
+
+/**
+ * Lit un nombre de threads : entier positif, au plus ThreadPool::getMaxThreadCount()
+ * @throw std::runtime_error si le texte n'est pas un nombre de threads valide
+ */
+size_t parseThreadCount(const std::string& text) {
+    size_t consumed = 0;
+    unsigned long count = 0;
+    // std::stoul accepte un signe '-' et renvoie alors une valeur repliée
+    if (!text.empty() && std::isdigit(static_cast<unsigned char>(text[0]))) {
+        try {
+            count = std::stoul(text, &consumed);
+        } catch (const std::exception&) {
+            consumed = 0;
+        }
+    }
+    if (consumed == 0 || consumed != text.size()) {
+        throw std::runtime_error("Nombre de threads invalide : " + text);
+    }
+    const size_t maximum = FusioCore::ThreadPool::getMaxThreadCount();
+    if (count > maximum) {
+        throw std::runtime_error("Nombre de threads invalide : " + text + " (maximum : " +
+                                 std::to_string(maximum) + ")");
+    }
+    return count;
+}
+
+/**
+ * Commandes de configuration du shell :
+ *   threads [n]               affiche ou fixe le nombre de threads (0 : nombre de cœurs)
+ *   deterministic [on|off]    affiche ou change le mode déterministe
+ *   format [fixed|shortest]   affiche ou change l'écriture des nombres
+ *   precision [n]             affiche ou fixe le nombre de décimales du format fixe
+ *   display [summary|full]    affiche ou change l'affichage des grandes valeurs
+ *   csvstats                  affiche les dimensions et le débit du dernier readcsv
+ * @return true si l'entrée était une commande
+ * @throw std::runtime_error si les arguments sont invalides
+ */
+bool handleCommand(const std::string& input, FusioCore::IShell& shell, const FusioCore::FusioInterpreter& interpreter) {
+    std::istringstream stream(input);
+    std::string command, argument, extra;
+    stream >> command >> argument >> extra;
+    if (!extra.empty()) {
+        return false;
+    }
+    
+    auto& pool = FusioCore::ThreadPool::getInstance();
+    if (command == "threads") {
+        if (!argument.empty()) {
+            pool.setThreadCount(parseThreadCount(argument));
+        }
+        shell.print("Threads : " + std::to_string(pool.getThreadCount()), FusioCore::ShellType::SUCCESS);
+        return true;
+    }
+    
+    if (command == "deterministic") {
+        if (argument == "on" || argument == "off") {
+            pool.setDeterministic(argument == "on");
+        } else if (!argument.empty()) {
+            throw std::runtime_error("Valeur attendue : on ou off");
+        }
+        shell.print(std::string("Mode déterministe : ") + (pool.isDeterministic() ? "on" : "off"),
+                    FusioCore::ShellType::SUCCESS);
+        return true;
+    }
+    
+    auto& formatter = FusioCore::ValueFormatter::getInstance();
+    FusioCore::FormatOptions options = formatter.getOptions();
+    if (command == "format") {
+        if (argument == "fixed" || argument == "shortest") {
+            options.format = argument == "fixed" ? FusioCore::NumberFormat::Fixed : FusioCore::NumberFormat::Shortest;
+            formatter.setOptions(options);
+        } else if (!argument.empty()) {
+            throw std::runtime_error("Valeur attendue : fixed ou shortest");
+        }
+        const bool fixed = options.format == FusioCore::NumberFormat::Fixed;
+        shell.print(std::string("Format : ") + (fixed ? "fixed" : "shortest"), FusioCore::ShellType::SUCCESS);
+        return true;
+    }
+    
+    if (command == "precision") {
+        if (!argument.empty()) {
+            size_t consumed = 0;
+            int precision = -1;
+            try {
+                precision = std::stoi(argument, &consumed);
+            } catch (const std::exception&) {
+                consumed = 0;
+            }
+            if (consumed != argument.size()) {
+                throw std::runtime_error("Précision invalide : " + argument);
+            }
+            options.precision = precision;
+            formatter.setOptions(options);
+        }
+        shell.print("Précision : " + std::to_string(formatter.getOptions().precision), FusioCore::ShellType::SUCCESS);
+        return true;
+    }
+    
+    if (command == "display") {
+        if (argument == "summary" || argument == "full") {
+            options.full = argument == "full";
+            formatter.setOptions(options);
+        } else if (!argument.empty()) {
+            throw std::runtime_error("Valeur attendue : summary ou full");
+        }
+        shell.print(std::string("Affichage : ") + (options.full ? "full" : "summary"), FusioCore::ShellType::SUCCESS);
+        return true;
+    }
+    
+    if (command == "csvstats" && argument.empty()) {
+        const FusioCore::CsvStats& stats = interpreter.getLastImport();
+        std::ostringstream oss;
+        oss << std::fixed << std::setprecision(1) << "Dernier import : " << stats.rows << " x " << stats.cols
+            << (stats.header ? " (avec en-tête), " : ", ") << stats.bytes / 1e6 << " Mo en " << stats.seconds * 1e3
+            << " ms, " << std::setprecision(2) << stats.throughput() / 1e9 << " Go/s sur " << stats.threads
+            << " thread(s)";
+        shell.print(oss.str(), FusioCore::ShellType::SUCCESS);
+        return true;
+    }
+    
+    return false;
+}
+
+/**
+ * Boucle interactive : invite, couleurs, affichage immédiat
+ */
+int runInteractive(FusioCore::FusioInterpreter& interpreter) {
     auto& shell = FusioCore::Shell::getInstance();
-    auto interpreter = std::make_unique<FusioCore::FusioInterpreter>();
     
     shell.print("Bienvenue dans l'interpréteur de FusioCore !", FusioCore::ShellType::INFO);
     shell.print("Tapez 'exit' ou 'quit' pour quitter.", FusioCore::ShellType::INFO);
@@ -19,13 +178,17 @@ int main() {
         shell.print(">> ", FusioCore::ShellType::INFO, false);
         input = shell.waitInput();
         
-        if (input == "exit" || input == "quit") {
+        if (input == "exit" || input == "quit" || !std::cin) {
             break;
         }
         
         try {
-            auto result = interpreter->evaluate(input);
-            shell.print(result->toString(), FusioCore::ShellType::SUCCESS);
+            if (handleCommand(input, shell, interpreter)) {
+                continue;
+            }
+            FusioCore::Value result = interpreter.evaluate(input);
+            printWarnings(shell, "Avertissement");
+            shell.printValue(result, FusioCore::ShellType::SUCCESS);
         } catch (const std::exception& e) {
             shell.print("Erreur : " + std::string(e.what()), FusioCore::ShellType::ERROR);
         }
@@ -33,3 +196,182 @@ int main() {
     
     return 0;
 }
+
+std::string formatMilliseconds(std::chrono::steady_clock::duration duration) {
+    std::ostringstream oss;
+    oss << std::fixed << std::setprecision(3)
+        << std::chrono::duration<double, std::milli>(duration).count() << " ms";
+    return oss.str();
+}
+
+/**
+ * Exécution d'un script : une instruction par ligne, sans invite ni couleurs
+ * Les lignes vides et celles commençant par '#' sont ignorées. Les erreurs
+ * sont signalées avec leur numéro de ligne et n'interrompent pas le script.
+ * @param input Le flux du script
+ * @param timings Affiche la durée de chaque instruction et la durée totale (sur la sortie d'erreur)
+ * @return Code de sortie : 0 si toutes les instructions ont réussi, 1 sinon
+ */
+int runBatch(std::istream& input, FusioCore::FusioInterpreter& interpreter, bool timings) {
+    using Clock = std::chrono::steady_clock;
+    auto& shell = FusioCore::BatchShell::getInstance();
+    
+    const auto start = Clock::now();
+    size_t lineNumber = 0;
+    size_t statements = 0;
+    bool failed = false;
+    
+    std::string line;
+    while (std::getline(input, line)) {
+        ++lineNumber;
+        
+        size_t first = line.find_first_not_of(" \t\r");
+        if (first == std::string::npos || line[first] == '#') {
+            continue;
+        }
+        size_t last = line.find_last_not_of(" \t\r");
+        std::string statement = line.substr(first, last - first + 1);
+        
+        if (statement == "exit" || statement == "quit") {
+            break;
+        }
+        
+        ++statements;
+        const auto statementStart = Clock::now();
+        try {
+            if (!handleCommand(statement, shell, interpreter)) {
+                FusioCore::Value result = interpreter.evaluate(statement);
+                printWarnings(shell, "Avertissement (ligne " + std::to_string(lineNumber) + ")");
+                shell.printValue(result, FusioCore::ShellType::SUCCESS);
+            }
+        } catch (const std::exception& e) {
+            failed = true;
+            shell.print("Erreur (ligne " + std::to_string(lineNumber) + ") : " + e.what(), FusioCore::ShellType::ERROR);
+        }
+        
+        if (timings) {
+            shell.print("[ligne " + std::to_string(lineNumber) + "] " +
+                        formatMilliseconds(Clock::now() - statementStart) + " : " + statement,
+                        FusioCore::ShellType::ERROR);
+        }
+    }
+    
+    if (timings) {
+        shell.print("Durée totale : " + formatMilliseconds(Clock::now() - start) + " (" +
+                    std::to_string(statements) + " instructions)", FusioCore::ShellType::ERROR);
+    }
+    shell.flush();
+    return failed ? 1 : 0;
+}
+
+FusioCore::EvaluationServer* runningServer = nullptr;
+
+void stopServer(int) {
+    if (runningServer) {
+        runningServer->stop();
+    }
+}
+
+/**
+ * Mode serveur : une session par connexion, jusqu'à SIGINT ou SIGTERM
+ * @return Code de sortie : 0 après un arrêt demandé, 2 si le serveur ne peut pas démarrer
+ */
+int runServer(const FusioCore::ServerOptions& options) {
+    try {
+        FusioCore::EvaluationServer server(options);
+        runningServer = &server;
+        std::signal(SIGINT, stopServer);
+        std::signal(SIGTERM, stopServer);
+        std::cerr << "Serveur à l'écoute : " << server.getAddress() << std::endl;
+        server.run();
+        runningServer = nullptr;
+    } catch (const std::exception& e) {
+        runningServer = nullptr;
+        std::cerr << "Erreur : " << e.what() << "\n";
+        return 2;
+    }
+    return 0;
+}
+
+void printUsage() {
+    std::cout << "Usage : FusioCore [--timings] [--evaluator exprtk|native] [script.fsc | -]\n"
+              << "        FusioCore --serve adresse [--serve-threads n] [--serve-root répertoire]\n"
+              << "  sans argument    shell interactif (ou script lu sur l'entrée standard redirigée)\n"
+              << "  script.fsc       exécute le script sans invite ni couleurs\n"
+              << "  -                lit le script sur l'entrée standard\n"
+              << "  --timings        affiche la durée de chaque instruction et la durée totale\n"
+              << "  --evaluator      moteur des expressions : exprtk (par défaut) ou native ;\n"
+              << "                   remplace la variable d'environnement FUSIO_EVALUATOR\n"
+              << "  --serve          sert les requêtes sur unix:/chemin, tcp:hôte:port ou port (127.0.0.1)\n"
+              << "  --serve-threads  nombre de boucles d'événements du serveur (par défaut : nombre de cœurs)\n"
+              << "  --serve-root     répertoire des fichiers de save, load et readcsv pour les clients\n"
+              << "                   (par défaut : instructions de fichier refusées)\n";
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    bool timings = false;
+    std::string scriptPath;
+    FusioCore::ServerOptions serverOptions;
+    
+    for (int i = 1; i < argc; ++i) {
+        std::string argument = argv[i];
+        if (argument == "--timings") {
+            timings = true;
+        } else if (argument == "--evaluator" && i + 1 < argc) {
+            try {
+                FusioCore::ExpressionEvaluatorFactory::setDefaultType(
+                    FusioCore::ExpressionEvaluatorFactory::typeFromName(argv[++i]));
+            } catch (const std::runtime_error& e) {
+                std::cerr << e.what() << "\n";
+                return 2;
+            }
+        } else if (argument == "--serve" && i + 1 < argc) {
+            serverOptions.address = argv[++i];
+        } else if (argument == "--serve-threads" && i + 1 < argc) {
+            try {
+                serverOptions.threads = parseThreadCount(argv[++i]);
+            } catch (const std::runtime_error& e) {
+                std::cerr << e.what() << "\n";
+                return 2;
+            }
+        } else if (argument == "--serve-root" && i + 1 < argc) {
+            serverOptions.fileRoot = argv[++i];
+        } else if (argument == "--help" || argument == "-h") {
+            printUsage();
+            return 0;
+        } else if (scriptPath.empty() && (argument == "-" || argument[0] != '-')) {
+            scriptPath = argument;
+        } else {
+            std::cerr << "Argument invalide : " << argument << "\n";
+            printUsage();
+            return 2;
+        }
+    }
+    
+    if (!serverOptions.address.empty()) {
+        if (!scriptPath.empty()) {
+            std::cerr << "--serve ne s'utilise pas avec un script\n";
+            return 2;
+        }
+        return runServer(serverOptions);
+    }
+    
+    auto interpreter = std::make_unique<FusioCore::FusioInterpreter>();
+    
+    // Mode script : fichier, "-" ou entrée standard redirigée
+    if (!scriptPath.empty() && scriptPath != "-") {
+        std::ifstream script(scriptPath);
+        if (!script) {
+            std::cerr << "Impossible d'ouvrir le script : " << scriptPath << "\n";
+            return 2;
+        }
+        return runBatch(script, *interpreter, timings);
+    }
+    if (scriptPath == "-" || !FUSIO_ISATTY(FUSIO_FILENO(stdin))) {
+        return runBatch(std::cin, *interpreter, timings);
+    }
+    
+    return runInteractive(*interpreter);
+}
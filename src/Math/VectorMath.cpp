@@ -0,0 +1,191 @@
+#include "Math/VectorMath.hpp"
+#include "Math/VectorMathKernels.hpp"
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <string>
+
+namespace FusioCore {
+
+#if defined(__GNUC__)
+
+const VectorMathTable& vectorMathTableScalar() {
+    // Même algorithme que les versions SIMD, une voie à la fois
+    return VectorMathKernels::Kernels<1>::table();
+}
+
+#else
+
+namespace {
+
+template <double (*F)(double)>
+void scalarKernel(const double* x, double* out, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        out[i] = F(x[i]);
+    }
+}
+
+double scalarSin(double x) { return std::sin(x); }
+double scalarCos(double x) { return std::cos(x); }
+double scalarTan(double x) { return std::tan(x); }
+double scalarExp(double x) { return std::exp(x); }
+double scalarLog(double x) { return std::log(x); }
+double scalarLog10(double x) { return std::log10(x); }
+double scalarSqrt(double x) { return std::sqrt(x); }
+
+} // namespace
+
+const VectorMathTable& vectorMathTableScalar() {
+    // Compilateurs sans extensions vectorielles : bibliothèque C
+    static const VectorMathTable kernels = {
+        scalarKernel<scalarSin>, scalarKernel<scalarCos>, scalarKernel<scalarTan>,
+        scalarKernel<scalarExp>, scalarKernel<scalarLog>, scalarKernel<scalarLog10>,
+        scalarKernel<scalarSqrt>
+    };
+    return kernels;
+}
+
+#endif
+
+namespace {
+
+// Le jeu d'instructions a-t-il été compilé ?
+bool isCompiled(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::Scalar:
+            return true;
+        case SimdLevel::SSE2:
+#if defined(FUSIO_VECTOR_MATH_SSE2)
+            return true;
+#else
+            return false;
+#endif
+        case SimdLevel::AVX2:
+#if defined(FUSIO_VECTOR_MATH_AVX2)
+            return true;
+#else
+            return false;
+#endif
+        case SimdLevel::AVX512:
+#if defined(FUSIO_VECTOR_MATH_AVX512)
+            return true;
+#else
+            return false;
+#endif
+    }
+    return false;
+}
+
+// Le processeur supporte-t-il le jeu d'instructions ?
+bool isSupportedByCpu(SimdLevel level) {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    __builtin_cpu_init();
+    switch (level) {
+        case SimdLevel::Scalar: return true;
+        case SimdLevel::SSE2: return __builtin_cpu_supports("sse2");
+        case SimdLevel::AVX2: return __builtin_cpu_supports("avx2");
+        case SimdLevel::AVX512: return __builtin_cpu_supports("avx512f");
+    }
+    return false;
+#else
+    return level == SimdLevel::Scalar;
+#endif
+}
+
+const VectorMathTable& tableFor(SimdLevel level) {
+    switch (level) {
+#if defined(FUSIO_VECTOR_MATH_SSE2)
+        case SimdLevel::SSE2: return vectorMathTableSSE2();
+#endif
+#if defined(FUSIO_VECTOR_MATH_AVX2)
+        case SimdLevel::AVX2: return vectorMathTableAVX2();
+#endif
+#if defined(FUSIO_VECTOR_MATH_AVX512)
+        case SimdLevel::AVX512: return vectorMathTableAVX512();
+#endif
+        default: return vectorMathTableScalar();
+    }
+}
+
+// Ramène un niveau au plus large effectivement disponible
+SimdLevel clampLevel(SimdLevel level) {
+    int value = static_cast<int>(level);
+    while (value > 0) {
+        auto candidate = static_cast<SimdLevel>(value);
+        if (isCompiled(candidate) && isSupportedByCpu(candidate)) {
+            return candidate;
+        }
+        --value;
+    }
+    return SimdLevel::Scalar;
+}
+
+SimdLevel initialLevel() {
+    const char* requested = std::getenv("FUSIO_SIMD");
+    if (requested) {
+        std::string name(requested);
+        if (name == "scalar") return SimdLevel::Scalar;
+        if (name == "sse2") return clampLevel(SimdLevel::SSE2);
+        if (name == "avx2") return clampLevel(SimdLevel::AVX2);
+        if (name == "avx512") return clampLevel(SimdLevel::AVX512);
+    }
+    return VectorMath::detectLevel();
+}
+
+// Niveau et table actifs, choisis au premier appel
+struct Dispatch {
+    Dispatch() {
+        SimdLevel initial = initialLevel();
+        level.store(initial);
+        table.store(&tableFor(initial));
+    }
+    
+    std::atomic<SimdLevel> level;
+    std::atomic<const VectorMathTable*> table;
+};
+
+Dispatch& dispatch() {
+    static Dispatch instance;
+    return instance;
+}
+
+const VectorMathTable& active() {
+    return *dispatch().table.load(std::memory_order_relaxed);
+}
+
+} // namespace
+
+void VectorMath::sin(const double* x, double* out, size_t n) { active().sin(x, out, n); }
+void VectorMath::cos(const double* x, double* out, size_t n) { active().cos(x, out, n); }
+void VectorMath::tan(const double* x, double* out, size_t n) { active().tan(x, out, n); }
+void VectorMath::exp(const double* x, double* out, size_t n) { active().exp(x, out, n); }
+void VectorMath::log(const double* x, double* out, size_t n) { active().log(x, out, n); }
+void VectorMath::log10(const double* x, double* out, size_t n) { active().log10(x, out, n); }
+void VectorMath::sqrt(const double* x, double* out, size_t n) { active().sqrt(x, out, n); }
+
+SimdLevel VectorMath::level() {
+    return dispatch().level.load();
+}
+
+SimdLevel VectorMath::detectLevel() {
+    return clampLevel(SimdLevel::AVX512);
+}
+
+SimdLevel VectorMath::setLevel(SimdLevel level) {
+    SimdLevel effective = clampLevel(level);
+    dispatch().level.store(effective);
+    dispatch().table.store(&tableFor(effective));
+    return effective;
+}
+
+const char* VectorMath::levelName(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::Scalar: return "scalar";
+        case SimdLevel::SSE2: return "sse2";
+        case SimdLevel::AVX2: return "avx2";
+        case SimdLevel::AVX512: return "avx512";
+    }
+    return "unknown";
+}
+
+} // namespace FusioCore
@@ -0,0 +1,13 @@
+#include "Math/VectorMathKernels.hpp"
+
+namespace FusioCore {
+
+#if defined(FUSIO_VECTOR_MATH_AVX2)
+
+const VectorMathTable& vectorMathTableAVX2() {
+    return VectorMathKernels::Kernels<4>::table();
+}
+
+#endif
+
+} // namespace FusioCore
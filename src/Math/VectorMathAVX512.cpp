@@ -0,0 +1,13 @@
+#include "Math/VectorMathKernels.hpp"
+
+namespace FusioCore {
+
+#if defined(FUSIO_VECTOR_MATH_AVX512)
+
+const VectorMathTable& vectorMathTableAVX512() {
+    return VectorMathKernels::Kernels<8>::table();
+}
+
+#endif
+
+} // namespace FusioCore
@@ -0,0 +1,13 @@
+#include "Math/VectorMathKernels.hpp"
+
+namespace FusioCore {
+
+#if defined(FUSIO_VECTOR_MATH_SSE2)
+
+const VectorMathTable& vectorMathTableSSE2() {
+    return VectorMathKernels::Kernels<2>::table();
+}
+
+#endif
+
+} // namespace FusioCore
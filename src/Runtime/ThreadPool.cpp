@@ -0,0 +1,243 @@
+#include "Runtime/ThreadPool.hpp"
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+
+namespace FusioCore {
+
+namespace {
+
+// Vrai dans les threads du pool et dans l'appelant pendant un travail
+thread_local bool insidePool = false;
+
+size_t hardwareThreads() {
+    size_t count = std::thread::hardware_concurrency();
+    return count == 0 ? 1 : count;
+}
+
+} // namespace
+
+ThreadPool& ThreadPool::getInstance() {
+    static ThreadPool instance;
+    return instance;
+}
+
+size_t ThreadPool::getMaxThreadCount() {
+    return MAX_THREADS_PER_CORE * hardwareThreads();
+}
+
+ThreadPool::ThreadPool() {
+    size_t count = 0;
+    if (const char* requested = std::getenv("FUSIO_NUM_THREADS")) {
+        char* end = nullptr;
+        unsigned long value = std::strtoul(requested, &end, 10);
+        if (end != requested && *end == '\0' && value <= getMaxThreadCount()) {
+            count = static_cast<size_t>(value);
+        }
+    }
+    setThreadCount(count);
+}
+
+ThreadPool::~ThreadPool() {
+    stopWorkers(*workers_);
+}
+
+size_t ThreadPool::getThreadCount() const {
+    return threadCount_.load();
+}
+
+void ThreadPool::setThreadCount(size_t count) {
+    if (count == 0) {
+        count = hardwareThreads();
+    }
+    if (count > getMaxThreadCount()) {
+        throw std::runtime_error("Nombre de threads invalide : " + std::to_string(count) + " (maximum : " +
+                                 std::to_string(getMaxThreadCount()) + ")");
+    }
+    
+    // Les nouveaux threads sont démarrés avant l'arrêt des anciens : un échec laisse le pool intact
+    std::lock_guard<std::mutex> submitLock(submitMutex_);
+    std::unique_ptr<Workers> started = startWorkers(count - 1);
+    stopWorkers(*workers_);
+    workers_ = std::move(started);
+    threadCount_.store(count);
+    configureEigen();
+}
+
+bool ThreadPool::isDeterministic() const {
+    return deterministic_.load();
+}
+
+void ThreadPool::setDeterministic(bool deterministic) {
+    std::lock_guard<std::mutex> submitLock(submitMutex_);
+    deterministic_.store(deterministic);
+    configureEigen();
+}
+
+void ThreadPool::parallelFor(Eigen::Index n, Eigen::Index grain, const RangeFunction& body) {
+    if (n <= 0) {
+        return;
+    }
+    grain = std::max<Eigen::Index>(grain, 1);
+    
+    // Exécution séquentielle : même découpage, dans l'ordre
+    auto sequential = [&] {
+        for (Eigen::Index begin = 0; begin < n; begin += grain) {
+            body(begin, std::min(begin + grain, n));
+        }
+    };
+    if (insidePool || n <= grain) {
+        sequential();
+        return;
+    }
+    
+    // Pool occupé par le travail d'un autre thread (sessions concurrentes) :
+    // le calcul reste sur le thread appelant plutôt que d'attendre son tour
+    std::unique_lock<std::mutex> submitLock(submitMutex_, std::try_to_lock);
+    if (!submitLock.owns_lock() || workers_->threads.empty()) {
+        sequential();
+        return;
+    }
+    
+    Job job;
+    job.body = &body;
+    job.size = n;
+    job.grain = grain;
+    job.remaining.store(n);
+    
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        job_ = &job;
+        ++generation_;
+    }
+    wakeCondition_.notify_all();
+    
+    // L'appelant participe au travail
+    insidePool = true;
+    runChunks(job);
+    insidePool = false;
+    
+    {
+        // Le travail est retiré une fois tous les threads sortis
+        std::unique_lock<std::mutex> lock(mutex_);
+        doneCondition_.wait(lock, [&] { return job.remaining.load() == 0 && activeWorkers_ == 0; });
+        job_ = nullptr;
+    }
+    
+    if (job.error) {
+        std::rethrow_exception(job.error);
+    }
+}
+
+double ThreadPool::parallelSum(Eigen::Index n, const PartialFunction& partial) {
+    if (n <= REDUCTION_BLOCK) {
+        return n > 0 ? partial(0, n) : 0.0;
+    }
+    
+    const Eigen::Index blocks = (n + REDUCTION_BLOCK - 1) / REDUCTION_BLOCK;
+    std::vector<double> partials(static_cast<size_t>(blocks));
+    parallelFor(blocks, 1, [&](Eigen::Index first, Eigen::Index last) {
+        for (Eigen::Index block = first; block < last; ++block) {
+            Eigen::Index begin = block * REDUCTION_BLOCK;
+            partials[block] = partial(begin, std::min(begin + REDUCTION_BLOCK, n));
+        }
+    });
+    
+    // Combinaison dans l'ordre des blocs : indépendante du nombre de threads
+    double sum = 0.0;
+    for (double value : partials) {
+        sum += value;
+    }
+    return sum;
+}
+
+std::unique_ptr<ThreadPool::Workers> ThreadPool::startWorkers(size_t count) {
+    auto workers = std::make_unique<Workers>();
+    try {
+        workers->threads.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            workers->threads.emplace_back(&ThreadPool::workerLoop, this, workers.get());
+        }
+    } catch (...) {
+        stopWorkers(*workers);
+        throw;
+    }
+    return workers;
+}
+
+void ThreadPool::stopWorkers(Workers& workers) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        workers.stopping = true;
+    }
+    wakeCondition_.notify_all();
+    for (auto& worker : workers.threads) {
+        worker.join();
+    }
+    workers.threads.clear();
+}
+
+void ThreadPool::workerLoop(const Workers* workers) {
+    insidePool = true;
+    size_t seenGeneration = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        seenGeneration = generation_;
+    }
+    
+    while (true) {
+        Job* job = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            wakeCondition_.wait(lock, [&] { return workers->stopping || generation_ != seenGeneration; });
+            if (workers->stopping) {
+                return;
+            }
+            seenGeneration = generation_;
+            job = job_;
+            if (!job) {
+                continue;
+            }
+            ++activeWorkers_;
+        }
+        
+        runChunks(*job);
+        
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            --activeWorkers_;
+        }
+        doneCondition_.notify_all();
+    }
+}
+
+void ThreadPool::runChunks(Job& job) {
+    while (true) {
+        Eigen::Index begin = job.next.fetch_add(job.grain);
+        if (begin >= job.size) {
+            return;
+        }
+        Eigen::Index end = std::min(begin + job.grain, job.size);
+        
+        try {
+            (*job.body)(begin, end);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!job.error) {
+                job.error = std::current_exception();
+            }
+        }
+        
+        if (job.remaining.fetch_sub(end - begin) == end - begin) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            doneCondition_.notify_all();
+        }
+    }
+}
+
+void ThreadPool::configureEigen() const {
+    // Sans OpenMP, Eigen reste séquentiel et cet appel est sans effet
+    Eigen::setNbThreads(deterministic_.load() ? 1 : static_cast<int>(threadCount_.load()));
+}
+
+} // namespace FusioCore
@@ -0,0 +1,497 @@
+#include "Server/EvaluationServer.hpp"
+#include "Expression/FusioInterpreter.hpp"
+#include "IO/MatrixFile.hpp"
+#include "Server/ServerProtocol.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <unordered_map>
+
+#ifdef __linux__
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace FusioCore {
+
+#ifdef __linux__
+
+namespace {
+
+// Octets lus par appel à read
+constexpr size_t READ_CHUNK = size_t(64) << 10;
+
+// Événements traités par appel à epoll_wait
+constexpr int MAX_EVENTS = 64;
+
+// Connexions acceptées par réveil : les autres boucles prennent la suite
+constexpr int MAX_ACCEPTS = 16;
+
+std::runtime_error systemError(const std::string& what) {
+    return std::runtime_error(what + " (" + std::strerror(errno) + ")");
+}
+
+/**
+ * Connexion : session et tampons d'entrée et de sortie
+ */
+struct Connection {
+    Connection(int socket, std::shared_ptr<ProgramCache> programs, const std::string& fileRoot)
+        : fd(socket), session(std::move(programs)) {
+        session.restrictFiles(fileRoot);
+    }
+    
+    int fd;
+    FusioInterpreter session;
+    std::string input;
+    size_t consumed = 0;     // Octets de input déjà traités
+    std::string output;
+    size_t written = 0;      // Octets de output déjà envoyés
+    uint32_t interest = 0;   // Événements epoll surveillés
+    bool peerClosed = false; // Plus rien à lire : fermée une fois les réponses envoyées
+    
+    size_t pendingOutput() const { return output.size() - written; }
+};
+
+} // namespace
+
+/**
+ * Boucle d'événements : connexions acceptées et servies par un thread
+ */
+struct EvaluationServer::Loop {
+    explicit Loop(EvaluationServer& owner) : server(owner) {
+        epoll = ::epoll_create1(EPOLL_CLOEXEC);
+        if (epoll < 0) {
+            throw systemError("Impossible de créer la boucle d'événements");
+        }
+        // La socket d'écoute est surveillée par toutes les boucles ; une seule est réveillée
+        watch(server.listener_, EPOLLIN | EPOLLEXCLUSIVE);
+        watch(server.stopEvent_, EPOLLIN);
+    }
+    
+    ~Loop() {
+        for (auto& entry : connections) {
+            ::close(entry.first);
+        }
+        ::close(epoll);
+    }
+    
+    void watch(int fd, uint32_t events) {
+        epoll_event event{};
+        event.events = events;
+        event.data.fd = fd;
+        if (::epoll_ctl(epoll, EPOLL_CTL_ADD, fd, &event) < 0) {
+            throw systemError("Impossible de surveiller la socket");
+        }
+    }
+    
+    void run() {
+        epoll_event events[MAX_EVENTS];
+        while (!server.stopping_.load()) {
+            const int count = ::epoll_wait(epoll, events, MAX_EVENTS, -1);
+            if (count < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                throw systemError("Erreur de la boucle d'événements");
+            }
+            for (int i = 0; i < count; ++i) {
+                const int fd = events[i].data.fd;
+                if (fd == server.stopEvent_) {
+                    return;
+                }
+                if (fd == server.listener_) {
+                    accept();
+                    continue;
+                }
+                auto it = connections.find(fd);
+                if (it != connections.end()) {
+                    onEvent(*it->second, events[i].events);
+                }
+            }
+        }
+    }
+    
+    void accept() {
+        for (int i = 0; i < MAX_ACCEPTS; ++i) {
+            const int fd = ::accept4(server.listener_, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+            if (fd < 0) {
+                // EAGAIN : plus de connexion en attente ; les autres erreurs ne concernent que celle-ci
+                return;
+            }
+            const int one = 1;
+            ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));  // Sans effet sur une socket Unix
+            
+            std::unique_ptr<Connection> connection;
+            try {
+                connection = std::make_unique<Connection>(fd, server.programs_, server.options_.fileRoot);
+            } catch (const std::exception&) {
+                // Répertoire des fichiers supprimé depuis le démarrage : connexion refusée
+                ::close(fd);
+                continue;
+            }
+            connection->interest = EPOLLIN | EPOLLRDHUP;
+            epoll_event event{};
+            event.events = connection->interest;
+            event.data.fd = fd;
+            if (::epoll_ctl(epoll, EPOLL_CTL_ADD, fd, &event) < 0) {
+                ::close(fd);
+                continue;
+            }
+            connections.emplace(fd, std::move(connection));
+        }
+    }
+    
+    void onEvent(Connection& connection, uint32_t events) {
+        if ((events & EPOLLERR) != 0) {
+            close(connection);
+            return;
+        }
+        if ((events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP)) != 0 && !receive(connection)) {
+            close(connection);
+            return;
+        }
+        // Requêtes reçues, y compris celles en attente d'une place dans le tampon de sortie
+        if (!process(connection) || !send(connection)) {
+            close(connection);
+            return;
+        }
+        if (connection.peerClosed && connection.pendingOutput() == 0) {
+            close(connection);
+            return;
+        }
+        updateInterest(connection);
+    }
+    
+    // Lit ce qui est disponible, au plus une requête de taille maximale non
+    // traitée (le reste au prochain réveil) ; false si la connexion est en erreur
+    bool receive(Connection& connection) {
+        const size_t maxUnprocessed = server.options_.maxRequestSize + ServerProtocol::LENGTH_SIZE;
+        while (connection.pendingOutput() <= MAX_PENDING_OUTPUT &&
+               connection.input.size() - connection.consumed < maxUnprocessed) {
+            const ssize_t count = ::read(connection.fd, buffer.data(), buffer.size());
+            if (count > 0) {
+                connection.input.append(buffer.data(), static_cast<size_t>(count));
+                continue;
+            }
+            if (count == 0) {
+                connection.peerClosed = true;
+                return true;
+            }
+            if (errno == EINTR) {
+                continue;
+            }
+            return errno == EAGAIN || errno == EWOULDBLOCK;
+        }
+        return true;
+    }
+    
+    // Exécute les requêtes complètes ; false si une requête dépasse la taille maximale
+    bool process(Connection& connection) {
+        const size_t headerSize = ServerProtocol::LENGTH_SIZE;
+        while (connection.pendingOutput() <= MAX_PENDING_OUTPUT) {
+            const size_t available = connection.input.size() - connection.consumed;
+            if (available < headerSize) {
+                break;
+            }
+            const char* request = connection.input.data() + connection.consumed;
+            const size_t length = ServerProtocol::readLength(request);
+            if (length > server.options_.maxRequestSize) {
+                return false;
+            }
+            if (available < headerSize + length) {
+                break;
+            }
+            respond(connection, std::string_view(request + headerSize, length));
+            connection.consumed += headerSize + length;
+        }
+        
+        // Retirer les requêtes traitées
+        if (connection.consumed == connection.input.size()) {
+            connection.input.clear();
+            connection.consumed = 0;
+        } else if (connection.consumed > READ_CHUNK) {
+            connection.input.erase(0, connection.consumed);
+            connection.consumed = 0;
+        }
+        return true;
+    }
+    
+    void respond(Connection& connection, std::string_view payload) {
+        const auto statements = ServerProtocol::splitStatements(payload);
+        std::string& out = connection.output;
+        const size_t start = ServerProtocol::beginResponse(out, static_cast<uint32_t>(statements.size()));
+        for (std::string_view statement : statements) {
+            try {
+                ServerProtocol::appendValue(out, connection.session.evaluate(std::string(statement)));
+            } catch (const std::exception& e) {
+                ServerProtocol::appendError(out, e.what());
+            }
+        }
+        try {
+            ServerProtocol::endResponse(out, start);
+        } catch (const std::exception& e) {
+            // Réponse retirée par endResponse : une seule erreur à la place
+            const size_t replacement = ServerProtocol::beginResponse(out, 1);
+            ServerProtocol::appendError(out, e.what());
+            ServerProtocol::endResponse(out, replacement);
+        }
+    }
+    
+    // Envoie les réponses en attente ; false si la connexion est en erreur
+    bool send(Connection& connection) {
+        while (connection.pendingOutput() > 0) {
+            const ssize_t count = ::send(connection.fd, connection.output.data() + connection.written,
+                                         connection.pendingOutput(), MSG_NOSIGNAL);
+            if (count > 0) {
+                connection.written += static_cast<size_t>(count);
+                continue;
+            }
+            if (count < 0 && errno == EINTR) {
+                continue;
+            }
+            if (count < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+                break;
+            }
+            return false;
+        }
+        if (connection.pendingOutput() == 0) {
+            connection.output.clear();
+            connection.written = 0;
+        }
+        return true;
+    }
+    
+    // Lecture suspendue tant que trop de réponses attendent, écriture surveillée s'il en reste
+    void updateInterest(Connection& connection) {
+        uint32_t interest = 0;
+        if (!connection.peerClosed && connection.pendingOutput() <= MAX_PENDING_OUTPUT) {
+            interest |= EPOLLIN | EPOLLRDHUP;
+        }
+        if (connection.pendingOutput() > 0) {
+            interest |= EPOLLOUT;
+        }
+        if (interest == connection.interest) {
+            return;
+        }
+        epoll_event event{};
+        event.events = interest;
+        event.data.fd = connection.fd;
+        ::epoll_ctl(epoll, EPOLL_CTL_MOD, connection.fd, &event);
+        connection.interest = interest;
+    }
+    
+    void close(Connection& connection) {
+        const int fd = connection.fd;
+        ::epoll_ctl(epoll, EPOLL_CTL_DEL, fd, nullptr);
+        ::close(fd);
+        connections.erase(fd);
+    }
+    
+    EvaluationServer& server;
+    int epoll = -1;
+    std::unordered_map<int, std::unique_ptr<Connection>> connections;
+    std::vector<char> buffer = std::vector<char>(READ_CHUNK);  // Lectures, copiées dans le tampon de la connexion
+};
+
+EvaluationServer::EvaluationServer(ServerOptions options)
+    : options_(std::move(options))
+    , programs_(std::make_shared<ProgramCache>())
+{
+    MatrixFile::requireLittleEndian("Mode serveur");
+    
+    // Répertoire des fichiers vérifié une fois, avant d'accepter des connexions
+    if (!options_.fileRoot.empty()) {
+        FusioInterpreter().restrictFiles(options_.fileRoot);
+    }
+    
+    const std::string& address = options_.address;
+    if (address.rfind("unix:", 0) == 0) {
+        const std::string path = address.substr(5);
+        sockaddr_un local{};
+        if (path.empty() || path.size() >= sizeof(local.sun_path)) {
+            throw std::runtime_error("Chemin de socket invalide : " + path);
+        }
+        local.sun_family = AF_UNIX;
+        std::memcpy(local.sun_path, path.c_str(), path.size() + 1);
+        
+        // Une socket laissée par un serveur précédent est remplacée ; un autre fichier, jamais
+        struct stat info{};
+        if (::stat(path.c_str(), &info) == 0 && S_ISSOCK(info.st_mode)) {
+            ::unlink(path.c_str());
+        }
+        
+        listener_ = ::socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        if (listener_ < 0) {
+            throw systemError("Impossible de créer la socket");
+        }
+        // Socket créée en 0600 : seul le propriétaire du serveur peut s'y connecter
+        const mode_t previousMask = ::umask(0177);
+        const int bound = ::bind(listener_, reinterpret_cast<const sockaddr*>(&local), sizeof(local));
+        ::umask(previousMask);
+        if (bound < 0) {
+            const auto error = systemError("Impossible d'écouter sur " + path);
+            ::close(listener_);
+            throw error;
+        }
+        unixPath_ = path;
+        address_ = address;
+    } else {
+        // "tcp:hôte:port" ou "port" (boucle locale)
+        std::string host = "127.0.0.1";
+        std::string port = address;
+        if (address.rfind("tcp:", 0) == 0) {
+            const size_t colon = address.rfind(':');
+            host = address.substr(4, colon - 4);
+            port = address.substr(colon + 1);
+            if (host.size() >= 2 && host.front() == '[' && host.back() == ']') {
+                host = host.substr(1, host.size() - 2);
+            }
+        }
+        if (port.empty() || port.find_first_not_of("0123456789") != std::string::npos) {
+            throw std::runtime_error("Adresse invalide : " + address + " (unix:/chemin, tcp:hôte:port ou port)");
+        }
+        
+        addrinfo hints{};
+        hints.ai_family = AF_UNSPEC;
+        hints.ai_socktype = SOCK_STREAM;
+        hints.ai_flags = AI_PASSIVE | AI_NUMERICSERV;
+        addrinfo* resolved = nullptr;
+        if (const int status = ::getaddrinfo(host.c_str(), port.c_str(), &hints, &resolved); status != 0) {
+            throw std::runtime_error("Adresse invalide : " + address + " (" + ::gai_strerror(status) + ")");
+        }
+        std::unique_ptr<addrinfo, decltype(&::freeaddrinfo)> guard(resolved, ::freeaddrinfo);
+        
+        listener_ = ::socket(resolved->ai_family, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        if (listener_ < 0) {
+            throw systemError("Impossible de créer la socket");
+        }
+        const int one = 1;
+        ::setsockopt(listener_, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+        if (::bind(listener_, resolved->ai_addr, resolved->ai_addrlen) < 0) {
+            const auto error = systemError("Impossible d'écouter sur " + address);
+            ::close(listener_);
+            throw error;
+        }
+        
+        // Port effectif (choisi par le système si 0)
+        sockaddr_storage bound{};
+        socklen_t size = sizeof(bound);
+        ::getsockname(listener_, reinterpret_cast<sockaddr*>(&bound), &size);
+        char service[NI_MAXSERV] = {};
+        ::getnameinfo(reinterpret_cast<const sockaddr*>(&bound), size, nullptr, 0, service, sizeof(service),
+                      NI_NUMERICSERV);
+        address_ = "tcp:" + host + ":" + service;
+    }
+    
+    // Échec après bind : le destructeur ne s'exécute pas, la socket et son fichier sont libérés ici
+    auto releaseListener = [&] {
+        ::close(listener_);
+        if (!unixPath_.empty()) {
+            ::unlink(unixPath_.c_str());
+        }
+    };
+    
+    if (::listen(listener_, SOMAXCONN) < 0) {
+        const auto error = systemError("Impossible d'écouter sur " + address);
+        releaseListener();
+        throw error;
+    }
+    
+    stopEvent_ = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (stopEvent_ < 0) {
+        const auto error = systemError("Impossible de créer l'événement d'arrêt");
+        releaseListener();
+        throw error;
+    }
+}
+
+EvaluationServer::~EvaluationServer() {
+    ::close(stopEvent_);
+    ::close(listener_);
+    if (!unixPath_.empty()) {
+        ::unlink(unixPath_.c_str());
+    }
+}
+
+void EvaluationServer::run() {
+    size_t count = options_.threads;
+    if (count == 0) {
+        count = std::max(1u, std::thread::hardware_concurrency());
+    }
+    
+    // Boucles créées avant de démarrer les threads : une erreur est signalée à l'appelant
+    std::vector<std::unique_ptr<Loop>> loops;
+    for (size_t i = 0; i < count; ++i) {
+        loops.push_back(std::make_unique<Loop>(*this));
+    }
+    
+    std::mutex errorMutex;
+    std::exception_ptr error;
+    auto serve = [&](Loop& loop) {
+        try {
+            loop.run();
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(errorMutex);
+            if (!error) {
+                error = std::current_exception();
+            }
+            stop();
+        }
+    };
+    
+    // La boucle 0 tourne dans le thread appelant
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < count; ++i) {
+        threads.emplace_back(serve, std::ref(*loops[i]));
+    }
+    serve(*loops[0]);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+void EvaluationServer::stop() {
+    stopping_.store(true);
+    const uint64_t one = 1;
+    // L'événement n'est jamais lu : toutes les boucles restent réveillées jusqu'à leur sortie
+    [[maybe_unused]] const ssize_t written = ::write(stopEvent_, &one, sizeof(one));
+}
+
+#else
+
+struct EvaluationServer::Loop {};
+
+EvaluationServer::EvaluationServer(ServerOptions options) : options_(std::move(options)) {
+    throw std::runtime_error("Mode serveur non disponible sur cette plateforme (epoll requis)");
+}
+
+EvaluationServer::~EvaluationServer() = default;
+
+void EvaluationServer::run() {}
+
+void EvaluationServer::stop() {
+    stopping_.store(true);
+}
+
+#endif
+
+const std::string& EvaluationServer::getAddress() const {
+    return address_;
+}
+
+} // namespace FusioCore
@@ -0,0 +1,143 @@
+#include "Server/ServerProtocol.hpp"
+#include "IO/MatrixFile.hpp"
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+namespace FusioCore {
+
+namespace {
+
+// Copie telle quelle (ordre des octets vérifié par MatrixFile::requireLittleEndian au démarrage du serveur)
+template <typename T>
+void append(std::string& out, T value) {
+    out.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void appendBytes(std::string& out, const void* data, size_t size) {
+    out.append(static_cast<const char*>(data), size);
+}
+
+bool isBlank(char c) {
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+} // namespace
+
+uint32_t ServerProtocol::readLength(const char* data) {
+    uint32_t length;
+    std::memcpy(&length, data, sizeof(length));
+    return length;
+}
+
+std::vector<std::string_view> ServerProtocol::splitStatements(std::string_view payload) {
+    std::vector<std::string_view> statements;
+    while (!payload.empty()) {
+        size_t end = payload.find('\n');
+        std::string_view line = payload.substr(0, end);
+        payload.remove_prefix(end == std::string_view::npos ? payload.size() : end + 1);
+        
+        while (!line.empty() && isBlank(line.front())) {
+            line.remove_prefix(1);
+        }
+        while (!line.empty() && isBlank(line.back())) {
+            line.remove_suffix(1);
+        }
+        if (!line.empty()) {
+            statements.push_back(line);
+        }
+    }
+    return statements;
+}
+
+size_t ServerProtocol::beginResponse(std::string& out, uint32_t count) {
+    const size_t start = out.size();
+    append<uint32_t>(out, 0);
+    append<uint32_t>(out, count);
+    return start;
+}
+
+void ServerProtocol::endResponse(std::string& out, size_t start) {
+    const size_t length = out.size() - start - LENGTH_SIZE;
+    if (length > std::numeric_limits<uint32_t>::max()) {
+        out.resize(start);
+        throw std::runtime_error("Réponse trop volumineuse");
+    }
+    const auto value = static_cast<uint32_t>(length);
+    std::memcpy(&out[start], &value, sizeof(value));
+}
+
+void ServerProtocol::appendValue(std::string& out, const Value& value) {
+    switch (value.kind()) {
+        case ValueKind::Scalar:
+            append<uint8_t>(out, RESULT_SCALAR);
+            append<double>(out, value.toDouble());
+            return;
+        
+        case ValueKind::Vector: {
+            const Vector& vector = value.as<Vector>();
+            append<uint8_t>(out, RESULT_VECTOR);
+            append<uint32_t>(out, MatrixFile::dtypeCode(vector.dtype()));
+            append<uint64_t>(out, vector.size());
+            dispatch(vector.dtype(), [&](auto tag) {
+                using T = typename decltype(tag)::type;
+                auto elements = vector.getTypedData<T>();
+                appendBytes(out, elements.data(), static_cast<size_t>(elements.size()) * sizeof(T));
+            });
+            return;
+        }
+        
+        case ValueKind::Matrix: {
+            const Matrix& matrix = value.as<Matrix>();
+            append<uint8_t>(out, RESULT_MATRIX);
+            append<uint32_t>(out, MatrixFile::dtypeCode(matrix.dtype()));
+            append<uint64_t>(out, matrix.rows());
+            append<uint64_t>(out, matrix.cols());
+            dispatch(matrix.dtype(), [&](auto tag) {
+                using T = typename decltype(tag)::type;
+                // Une vue non contiguë est copiée par getTypedData
+                auto elements = matrix.getTypedData<T>();
+                if (elements.outerStride() == elements.rows()) {
+                    appendBytes(out, elements.data(), static_cast<size_t>(elements.size()) * sizeof(T));
+                    return;
+                }
+                for (Eigen::Index j = 0; j < elements.cols(); ++j) {
+                    appendBytes(out, elements.col(j).data(), static_cast<size_t>(elements.rows()) * sizeof(T));
+                }
+            });
+            return;
+        }
+        
+        case ValueKind::Sparse: {
+            const SparseMatrix::Storage& data = value.as<SparseMatrix>().getData();
+            append<uint8_t>(out, RESULT_SPARSE);
+            append<uint64_t>(out, static_cast<uint64_t>(data.rows()));
+            append<uint64_t>(out, static_cast<uint64_t>(data.cols()));
+            append<uint64_t>(out, static_cast<uint64_t>(data.nonZeros()));
+            
+            // Lignes, colonnes puis valeurs, chacune en un bloc
+            std::string cols;
+            std::string values;
+            cols.reserve(static_cast<size_t>(data.nonZeros()) * sizeof(uint64_t));
+            values.reserve(static_cast<size_t>(data.nonZeros()) * sizeof(double));
+            for (Eigen::Index j = 0; j < data.outerSize(); ++j) {
+                for (SparseMatrix::Storage::InnerIterator it(data, j); it; ++it) {
+                    append<uint64_t>(out, static_cast<uint64_t>(it.row()));
+                    append<uint64_t>(cols, static_cast<uint64_t>(it.col()));
+                    append<double>(values, it.value());
+                }
+            }
+            out += cols;
+            out += values;
+            return;
+        }
+    }
+}
+
+void ServerProtocol::appendError(std::string& out, std::string_view message) {
+    append<uint8_t>(out, RESULT_ERROR);
+    append<uint32_t>(out, static_cast<uint32_t>(message.size()));
+    out.append(message);
+}
+
+} // namespace FusioCore
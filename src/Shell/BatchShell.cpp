@@ -0,0 +1,110 @@
+#include "Shell/BatchShell.hpp"
+#include "Value/ValueFormatter.hpp"
+#include "Version.hpp"
+#include <string>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <sys/stat.h>
+#endif
+
+namespace FusioCore {
+
+namespace {
+
+/**
+ * Indique si la sortie standard et la sortie d'erreur aboutissent au même
+ * endroit (même terminal, ou redirection commune comme 2>&1) : l'ordre entre
+ * les deux flux n'est alors visible qu'en vidant std::cout avant chaque erreur.
+ */
+bool outputsShared() {
+#ifdef _WIN32
+    return _isatty(1) && _isatty(2);
+#else
+    struct stat out, err;
+    if (::fstat(1, &out) != 0 || ::fstat(2, &err) != 0) {
+        return false;
+    }
+    return out.st_dev == err.st_dev && out.st_ino == err.st_ino;
+#endif
+}
+
+} // namespace
+
+BatchShell& BatchShell::getInstance() {
+    static BatchShell instance;
+    return instance;
+}
+
+BatchShell::BatchShell() : sharedOutput_(outputsShared()) {
+    // Flux C++ découplés de stdio : std::cout dispose de son propre tampon
+    std::ios::sync_with_stdio(false);
+    std::cin.tie(nullptr);
+    // std::cerr est lié à std::cout : chaque erreur viderait la sortie standard
+    std::cerr.tie(nullptr);
+}
+
+BatchShell::~BatchShell() {
+    flush();
+}
+
+void BatchShell::print(const std::string& message, bool newLine) const {
+    std::cout << message;
+    if (newLine) {
+        std::cout << '\n';
+    }
+}
+
+void BatchShell::print(const std::string& message, ShellType type, bool newLine) const {
+    std::ostream& stream = streamFor(type);
+    stream << message;
+    if (newLine) {
+        stream << '\n';
+    }
+}
+
+void BatchShell::printBold(const std::string& message, bool newLine) const {
+    print(message, newLine);
+}
+
+void BatchShell::printBold(const std::string& message, ShellType type, bool newLine) const {
+    print(message, type, newLine);
+}
+
+void BatchShell::printValue(const Value& value, ShellType type, bool newLine) const {
+    std::ostream& stream = streamFor(type);
+    ValueFormatter::getInstance().write(stream, value);
+    if (newLine) {
+        stream << '\n';
+    }
+}
+
+void BatchShell::printProjectInfo() const {
+    print(std::string(Version::NAME) + " v" + std::string(Version::VERSION));
+}
+
+std::string BatchShell::waitInput(const std::string&) {
+    std::string input;
+    std::getline(std::cin, input);
+    return input;
+}
+
+void BatchShell::flush() const {
+    std::cout.flush();
+    std::cerr.flush();
+}
+
+std::ostream& BatchShell::streamFor(ShellType type) const {
+    // Les erreurs et avertissements sont séparés des résultats ; la sortie standard
+    // n'est vidée d'abord que si les deux flux se mélangent, pour y conserver l'ordre
+    if (type == ShellType::ERROR || type == ShellType::WARNING) {
+        if (sharedOutput_) {
+            std::cout.flush();
+        }
+        return std::cerr;
+    }
+    return std::cout;
+}
+
+} // namespace FusioCore
@@ -1,4 +1,5 @@
 #include "Shell/Shell.hpp"
+#include "Value/ValueFormatter.hpp"
 #include "Version.hpp"
 #include <iostream>
 #include <string>
@@ -34,6 +35,12 @@ void Shell::printBold(const std::string& message, ShellType type, bool newLine)
     std::cout << getAnsiCode({static_cast<int>(ANSI_Effect::BOLD)}) << getColorCode(type) << message << resetAnsi() << (newLine ? "\n" : "") << std::flush;
 }
 
+void Shell::printValue(const Value& value, ShellType type, bool newLine) const {
+    std::cout << getColorCode(type);
+    ValueFormatter::getInstance().write(std::cout, value);
+    std::cout << resetAnsi() << (newLine ? "\n" : "") << std::flush;
+}
+
 void Shell::printProjectInfo() const {
     printBold("=== " + std::string(Version::NAME) + " v" + std::string(Version::VERSION) + " ===", ShellType::INFO);
 }
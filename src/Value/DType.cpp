@@ -0,0 +1,33 @@
+#include "Value/DType.hpp"
+
+namespace FusioCore {
+
+DType promote(DType a, DType b) {
+    if (a == b) {
+        return a;
+    }
+    if (isInteger(a) && isInteger(b)) {
+        return DType::I64;
+    }
+    return DType::F64;
+}
+
+DType floating(DType dtype) {
+    return isInteger(dtype) ? DType::F64 : dtype;
+}
+
+bool isInteger(DType dtype) {
+    return dtype == DType::I32 || dtype == DType::I64;
+}
+
+const char* dtypeName(DType dtype) {
+    switch (dtype) {
+        case DType::F32: return "single";
+        case DType::F64: return "double";
+        case DType::I32: return "int32";
+        case DType::I64: return "int64";
+    }
+    return "?";
+}
+
+} // namespace FusioCore
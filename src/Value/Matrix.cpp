@@ -1,90 +1,450 @@
 #include "Value/Value.hpp"
-#include <sstream>
-#include <iomanip>
+#include "Value/ValueFormatter.hpp"
+#include "Value/Variant.hpp"
+#include "Value/Warnings.hpp"
+#include "Runtime/ThreadPool.hpp"
+#include <cstdio>
+#include <limits>
 #include <stdexcept>
+#include <utility>
 
 namespace FusioCore {
 
-Matrix::Matrix(const Eigen::MatrixXd& data) : data_(data) {}
+Matrix::Matrix(Eigen::MatrixXd data) : data_(std::make_shared<Eigen::MatrixXd>(std::move(data))) {}
 
 Matrix::Matrix(size_t rows, size_t cols, double defaultValue) 
-    : data_(Eigen::MatrixXd::Constant(rows, cols, defaultValue)) {}
+    : data_(std::make_shared<Eigen::MatrixXd>(Eigen::MatrixXd::Constant(rows, cols, defaultValue))) {}
 
-const Eigen::MatrixXd& Matrix::getData() const {
-    return data_;
+template <typename T>
+Matrix::Matrix(MatrixOf<T> data) {
+    auto elements = std::make_shared<const MatrixOf<T>>(std::move(data));
+    typed_.dtype = DTypeOf<T>::value;
+    typed_.data = elements->data();
+    typed_.rows = elements->rows();
+    typed_.cols = elements->cols();
+    typed_.owner = std::move(elements);
+}
+
+template Matrix::Matrix(MatrixOf<float>);
+template Matrix::Matrix(MatrixOf<int32_t>);
+template Matrix::Matrix(MatrixOf<int64_t>);
+
+Matrix::Matrix(const double* data, Eigen::Index rows, Eigen::Index cols, std::shared_ptr<const void> owner) {
+    external_.owner = std::move(owner);
+    external_.data = data;
+    external_.rows = rows;
+    external_.cols = cols;
+    external_.outerStride = rows;
+}
+
+Matrix::Matrix(const double* data, Eigen::Index rows, Eigen::Index cols, Eigen::Index outerStride,
+               Eigen::Index innerStride, std::shared_ptr<const void> owner)
+    : Matrix(data, rows, cols, std::move(owner)) {
+    if (outerStride <= 0 || innerStride <= 0) {
+        throw std::runtime_error("Pas de stockage externe invalide");
+    }
+    external_.outerStride = outerStride;
+    external_.innerStride = innerStride;
+}
+
+template <typename T>
+Matrix::Matrix(const T* data, Eigen::Index rows, Eigen::Index cols, std::shared_ptr<const void> owner) {
+    typed_.dtype = DTypeOf<T>::value;
+    typed_.data = data;
+    typed_.rows = rows;
+    typed_.cols = cols;
+    typed_.owner = std::move(owner);
+    typed_.external = true;
+}
+
+template Matrix::Matrix(const float*, Eigen::Index, Eigen::Index, std::shared_ptr<const void>);
+template Matrix::Matrix(const int32_t*, Eigen::Index, Eigen::Index, std::shared_ptr<const void>);
+template Matrix::Matrix(const int64_t*, Eigen::Index, Eigen::Index, std::shared_ptr<const void>);
+
+Eigen::Ref<const Eigen::MatrixXd> Matrix::getData() const {
+    if (typed_.data) {
+        return widened();
+    }
+    if (external_.data && external_.innerStride == 1) {
+        // Lignes consécutives : colonnes espacées, référencées sans copie
+        return Eigen::Map<const Eigen::MatrixXd, 0, Eigen::OuterStride<>>(
+            external_.data, external_.rows, external_.cols, Eigen::OuterStride<>(external_.outerStride));
+    }
+    if (external_.data) {
+        return view();
+    }
+    return *data_;
 }
 
 Eigen::MatrixXd& Matrix::getData() {
-    return data_;
+    detach();
+    invalidateFactorizations();
+    return *data_;
 }
 
-void Matrix::setData(const Eigen::MatrixXd& data) {
-    data_ = data;
+void Matrix::setData(Eigen::MatrixXd data) {
+    invalidateFactorizations();
+    external_ = External();
+    typed_ = Typed();
+    data_ = std::make_shared<Eigen::MatrixXd>(std::move(data));
 }
 
 size_t Matrix::rows() const {
-    return static_cast<size_t>(data_.rows());
+    return static_cast<size_t>(typed_.data ? typed_.rows : view().rows());
 }
 
 size_t Matrix::cols() const {
-    return static_cast<size_t>(data_.cols());
+    return static_cast<size_t>(typed_.data ? typed_.cols : view().cols());
 }
 
-double& Matrix::operator()(size_t i, size_t j) {
-    return data_(static_cast<int>(i), static_cast<int>(j));
+bool Matrix::isExternal() const {
+    return external_.data != nullptr || typed_.external;
 }
 
-const double& Matrix::operator()(size_t i, size_t j) const {
-    return data_(static_cast<int>(i), static_cast<int>(j));
+bool Matrix::isContiguous() const {
+    return !external_.data || (external_.innerStride == 1 && external_.outerStride == external_.rows);
 }
 
-std::string Matrix::toString() const {
-    std::ostringstream oss;
-    oss << "[";
-    for (int i = 0; i < data_.rows(); ++i) {
-        if (i > 0) oss << "; ";
-        for (int j = 0; j < data_.cols(); ++j) {
-            if (j > 0) oss << " ";
-            oss << std::fixed << std::setprecision(6) << data_(i, j);
+void Matrix::materialize() {
+    if (!isContiguous()) {
+        data_ = std::make_shared<Eigen::MatrixXd>(view());
+        external_ = External();
+    }
+}
+
+DType Matrix::dtype() const {
+    return typed_.dtype;
+}
+
+template <typename T>
+Eigen::Ref<const MatrixOf<T>> Matrix::getTypedData() const {
+    if (DTypeOf<T>::value != dtype()) {
+        throw std::runtime_error(std::string("Matrice de type ") + dtypeName(dtype()) + " lue comme " +
+                                 dtypeName(DTypeOf<T>::value));
+    }
+    if constexpr (std::is_same_v<T, double>) {
+        return getData();
+    } else {
+        return Eigen::Map<const MatrixOf<T>>(static_cast<const T*>(typed_.data), typed_.rows, typed_.cols);
+    }
+}
+
+template Eigen::Ref<const MatrixOf<float>> Matrix::getTypedData<float>() const;
+template Eigen::Ref<const MatrixOf<double>> Matrix::getTypedData<double>() const;
+template Eigen::Ref<const MatrixOf<int32_t>> Matrix::getTypedData<int32_t>() const;
+template Eigen::Ref<const MatrixOf<int64_t>> Matrix::getTypedData<int64_t>() const;
+
+template <typename T>
+Eigen::Ref<const MatrixOf<T>> Matrix::elementsAs() const {
+    if constexpr (std::is_same_v<T, double>) {
+        if (!typed_.data) {
+            return getData();
         }
     }
-    oss << "]";
-    return oss.str();
+    if (!typed_.data) {
+        return view().template cast<T>();
+    }
+    // Même type : cast<T>() est l'identité et la référence porte sur les éléments eux-mêmes
+    return dispatch(dtype(), [&](auto tag) -> Eigen::Ref<const MatrixOf<T>> {
+        using Element = typename decltype(tag)::type;
+        return Eigen::Map<const MatrixOf<Element>>(static_cast<const Element*>(typed_.data), typed_.rows,
+                                                   typed_.cols).template cast<T>();
+    });
+}
+
+Matrix Matrix::astype(DType target) const {
+    if (target == dtype()) {
+        return *this;
+    }
+    return dispatch(target, [&](auto tag) {
+        using T = typename decltype(tag)::type;
+        if constexpr (std::is_same_v<T, double>) {
+            return Matrix(Eigen::MatrixXd(elementsAs<double>()));
+        } else {
+            // Conversion unique depuis le double (sans copie intermédiaire pour une matrice double)
+            return Matrix(narrowed<T>(elementsAs<double>()));
+        }
+    });
+}
+
+template <typename Operation>
+Matrix Matrix::combine(const Matrix& other, Operation operation) const {
+    return dispatch(promote(dtype(), other.dtype()), [&](auto tag) {
+        using T = typename decltype(tag)::type;
+        using C = ComputeType<T>;
+        return Matrix(saturated<T>(operation(elementsAs<C>(), other.elementsAs<C>())));
+    });
+}
+
+double& Matrix::operator()(size_t i, size_t j) {
+    detach();
+    invalidateFactorizations();
+    return (*data_)(static_cast<Eigen::Index>(i), static_cast<Eigen::Index>(j));
+}
+
+double Matrix::operator()(size_t i, size_t j) const {
+    if (typed_.data) {
+        return dispatch(dtype(), [&](auto tag) {
+            using T = typename decltype(tag)::type;
+            const T* elements = static_cast<const T*>(typed_.data);
+            return static_cast<double>(elements[static_cast<Eigen::Index>(j) * typed_.rows +
+                                                static_cast<Eigen::Index>(i)]);
+        });
+    }
+    if (external_.data) {
+        return external_.data[static_cast<Eigen::Index>(j) * external_.outerStride +
+                              static_cast<Eigen::Index>(i) * external_.innerStride];
+    }
+    return (*data_)(static_cast<Eigen::Index>(i), static_cast<Eigen::Index>(j));
+}
+
+std::string Matrix::toString() const {
+    return ValueFormatter::getInstance().toString(Value(*this));
 }
 
 Matrix Matrix::operator+(const Matrix& other) const {
-    return Matrix(data_ + other.data_);
+    if (typed_.data || other.typed_.data) {
+        return combine(other, [](const auto& a, const auto& b) { return a + b; });
+    }
+    return Matrix(view() + other.view());
 }
 
 Matrix Matrix::operator-(const Matrix& other) const {
-    return Matrix(data_ - other.data_);
+    if (typed_.data || other.typed_.data) {
+        return combine(other, [](const auto& a, const auto& b) { return a - b; });
+    }
+    return Matrix(view() - other.view());
 }
 
 Matrix Matrix::operator*(const Matrix& other) const {
-    return Matrix(data_ * other.data_);
+    if (cols() != other.rows()) {
+        throw std::runtime_error("Dimensions incompatibles pour le produit matriciel");
+    }
+    const DType type = promote(dtype(), other.dtype());
+    if (type == DType::F64) {
+        Eigen::MatrixXd result(static_cast<Eigen::Index>(rows()), static_cast<Eigen::Index>(other.cols()));
+        ThreadPool::getInstance().multiply(result, elementsAs<double>(), other.elementsAs<double>(), 1.0, false);
+        return Matrix(std::move(result));
+    }
+    // Produit Eigen dans le type des éléments (float : deux fois plus d'éléments par registre SIMD)
+    return dispatch(type, [&](auto tag) {
+        using T = typename decltype(tag)::type;
+        using C = ComputeType<T>;
+        return Matrix(narrowed<T>(MatrixOf<C>(elementsAs<C>() * other.elementsAs<C>())));
+    });
 }
 
 Matrix Matrix::operator*(const Scalar& scalar) const {
-    return Matrix(data_ * scalar.getValue());
+    if (typed_.data) {
+        return dispatch(dtype(), [&](auto tag) {
+            using T = typename decltype(tag)::type;
+            using C = ComputeType<T>;
+            return Matrix(narrowed<T>(elementsAs<C>() * static_cast<C>(scalar.getValue())));
+        });
+    }
+    return Matrix(view() * scalar.getValue());
 }
 
 Vector Matrix::operator*(const Vector& vector) const {
-    return Vector(data_ * vector.getData());
+    if (!typed_.data && vector.dtype() == DType::F64) {
+        return Vector(view() * vector.getData());
+    }
+    return dispatch(promote(dtype(), vector.dtype()), [&](auto tag) {
+        using T = typename decltype(tag)::type;
+        using C = ComputeType<T>;
+        return Vector(narrowed<T>(VectorOf<C>(elementsAs<C>() * vector.elementsAs<C>())));
+    });
 }
 
 Matrix Matrix::transpose() const {
-    return Matrix(data_.transpose());
+    if (typed_.data) {
+        return dispatch(dtype(), [&](auto tag) {
+            using T = typename decltype(tag)::type;
+            return Matrix(MatrixOf<T>(getTypedData<T>().transpose()));
+        });
+    }
+    Matrix result = slice({0, view().rows(), 1}, {0, view().cols(), 1});
+    std::swap(result.external_.rows, result.external_.cols);
+    std::swap(result.external_.outerStride, result.external_.innerStride);
+    return result;
+}
+
+Matrix Matrix::slice(const Range& rows, const Range& cols) const {
+    if (typed_.data) {
+        // Éléments d'un autre type : sous-matrice copiée
+        const Eigen::Index rowCount = typed_.rows;
+        const Eigen::Index colCount = typed_.cols;
+        if (rows.size < 0 || cols.size < 0 || rows.step < 1 || cols.step < 1 ||
+            (rows.size > 0 && (rows.first < 0 || rows.first + (rows.size - 1) * rows.step >= rowCount)) ||
+            (cols.size > 0 && (cols.first < 0 || cols.first + (cols.size - 1) * cols.step >= colCount))) {
+            throw std::runtime_error("Sous-matrice hors des dimensions de la matrice (" +
+                                     std::to_string(rowCount) + "x" + std::to_string(colCount) + ")");
+        }
+        return dispatch(dtype(), [&](auto tag) {
+            using T = typename decltype(tag)::type;
+            const T* first = static_cast<const T*>(typed_.data) + (rows.size > 0 ? rows.first : 0) +
+                             (cols.size > 0 ? cols.first : 0) * rowCount;
+            Eigen::Map<const MatrixOf<T>, 0, Eigen::Stride<Eigen::Dynamic, Eigen::Dynamic>> elements(
+                first, rows.size, cols.size, Eigen::Stride<Eigen::Dynamic, Eigen::Dynamic>(rowCount * cols.step, rows.step));
+            return Matrix(MatrixOf<T>(elements));
+        });
+    }
+    const StridedMap elements = view();
+    if (rows.size < 0 || cols.size < 0 || rows.step < 1 || cols.step < 1 ||
+        (rows.size > 0 && (rows.first < 0 || rows.first + (rows.size - 1) * rows.step >= elements.rows())) ||
+        (cols.size > 0 && (cols.first < 0 || cols.first + (cols.size - 1) * cols.step >= elements.cols()))) {
+        throw std::runtime_error("Sous-matrice hors des dimensions de la matrice (" +
+                                 std::to_string(elements.rows()) + "x" + std::to_string(elements.cols()) + ")");
+    }
+    
+    // La vue garde en vie le stockage d'origine ; une écriture dans l'une ou
+    // l'autre matrice porte sur une copie (copie à l'écriture)
+    const Eigen::Index row = rows.size > 0 ? rows.first : 0;
+    const Eigen::Index col = cols.size > 0 ? cols.first : 0;
+    Matrix result(elements.data() + row * elements.innerStride() + col * elements.outerStride(),
+                  rows.size, cols.size, external_.data ? external_.owner : std::shared_ptr<const void>(data_));
+    result.external_.innerStride = elements.innerStride() * rows.step;
+    result.external_.outerStride = elements.outerStride() * cols.step;
+    return result;
+}
+
+Matrix Matrix::block(Eigen::Index row, Eigen::Index col, Eigen::Index rows, Eigen::Index cols) const {
+    return slice({row, rows, 1}, {col, cols, 1});
 }
 
 Scalar Matrix::determinant() const {
-    return Scalar(data_.determinant());
+    if (view().rows() != view().cols()) {
+        throw std::runtime_error("Le déterminant requiert une matrice carrée");
+    }
+    return Scalar(lu().determinant());
 }
 
 Matrix Matrix::inverse() const {
-    if (data_.determinant() == 0.0) {
+    if (view().rows() != view().cols()) {
+        throw std::runtime_error("L'inverse requiert une matrice carrée");
+    }
+    requireInvertible();
+    return Matrix(lu().inverse());
+}
+
+const Eigen::PartialPivLU<Eigen::MatrixXd>& Matrix::lu() const {
+    if (!factorizations_.lu) {
+        factorizations_.lu = std::make_shared<const Eigen::PartialPivLU<Eigen::MatrixXd>>(view());
+        factorizations_.invertible = isInvertible(*factorizations_.lu);
+        // L'estimation du conditionnement coûte quelques résolutions (O(n²))
+        factorizations_.rcond = factorizations_.invertible ? factorizations_.lu->rcond() : 0.0;
+    }
+    return *factorizations_.lu;
+}
+
+const Eigen::LLT<Eigen::MatrixXd>& Matrix::cholesky() const {
+    if (!factorizations_.cholesky) {
+        factorizations_.cholesky = std::make_shared<const Eigen::LLT<Eigen::MatrixXd>>(view());
+    }
+    if (factorizations_.cholesky->info() != Eigen::Success) {
+        throw std::runtime_error("La matrice n'est pas symétrique définie positive");
+    }
+    return *factorizations_.cholesky;
+}
+
+const Eigen::ColPivHouseholderQR<Eigen::MatrixXd>& Matrix::qr() const {
+    if (!factorizations_.qr) {
+        factorizations_.qr = std::make_shared<const Eigen::ColPivHouseholderQR<Eigen::MatrixXd>>(view());
+    }
+    return *factorizations_.qr;
+}
+
+Matrix Matrix::solve(const Matrix& rhs) const {
+    return Matrix(solveWith(rhs.getData()));
+}
+
+Vector Matrix::solve(const Vector& rhs) const {
+    return Vector(solveWith(rhs.getData()));
+}
+
+bool Matrix::isInvertible() const {
+    lu();
+    return factorizations_.invertible;
+}
+
+bool Matrix::isInvertible(const Eigen::PartialPivLU<Eigen::MatrixXd>& lu) {
+    return !(lu.matrixLU().diagonal().array() == 0.0).any();
+}
+
+namespace {
+
+void checkInvertible(bool invertible, double rcond) {
+    if (!invertible) {
         throw std::runtime_error("Matrix is not invertible");
     }
-    return Matrix(data_.inverse());
+    if (rcond <= std::numeric_limits<double>::epsilon()) {
+        char message[128];
+        std::snprintf(message, sizeof(message),
+                      "Matrice mal conditionnée (rcond = %.3g) : le résultat peut être imprécis", rcond);
+        Warnings::report(message);
+    }
+}
+
+} // namespace
+
+void Matrix::requireInvertible() const {
+    lu();
+    checkInvertible(factorizations_.invertible, factorizations_.rcond);
+}
+
+void Matrix::requireInvertible(const Eigen::PartialPivLU<Eigen::MatrixXd>& lu) {
+    bool invertible = isInvertible(lu);
+    checkInvertible(invertible, invertible ? lu.rcond() : 0.0);
+}
+
+template <typename Rhs>
+Eigen::MatrixXd Matrix::solveWith(const Rhs& rhs) const {
+    if (rhs.rows() != view().rows()) {
+        throw std::runtime_error("Dimensions incompatibles pour la résolution : " +
+                                 std::to_string(view().rows()) + " lignes et " +
+                                 std::to_string(rhs.rows()) + " lignes");
+    }
+    if (view().rows() == view().cols()) {
+        requireInvertible();
+        return lu().solve(rhs);
+    }
+    return qr().solve(rhs);
+}
+
+void Matrix::invalidateFactorizations() {
+    factorizations_ = Factorizations();
+}
+
+const Eigen::MatrixXd& Matrix::widened() const {
+    if (!typed_.widened) {
+        typed_.widened = std::make_shared<const Eigen::MatrixXd>(elementsAs<double>());
+    }
+    return *typed_.widened;
+}
+
+Matrix::StridedMap Matrix::view() const {
+    using Stride = Eigen::Stride<Eigen::Dynamic, Eigen::Dynamic>;
+    if (typed_.data) {
+        const Eigen::MatrixXd& elements = widened();
+        return StridedMap(elements.data(), elements.rows(), elements.cols(), Stride(elements.rows(), 1));
+    }
+    if (external_.data) {
+        return StridedMap(external_.data, external_.rows, external_.cols,
+                          Stride(external_.outerStride, external_.innerStride));
+    }
+    return StridedMap(data_->data(), data_->rows(), data_->cols(), Stride(data_->rows(), 1));
+}
+
+void Matrix::detach() {
+    if (typed_.data) {
+        data_ = std::make_shared<Eigen::MatrixXd>(widened());
+        typed_ = Typed();
+    } else if (external_.data) {
+        data_ = std::make_shared<Eigen::MatrixXd>(view());
+        external_ = External();
+    } else if (data_.use_count() > 1) {
+        data_ = std::make_shared<Eigen::MatrixXd>(*data_);
+    }
 }
 
 } // namespace FusioCore 
\ No newline at end of file
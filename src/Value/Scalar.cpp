@@ -1,6 +1,6 @@
 #include "Value/Value.hpp"
-#include <sstream>
-#include <iomanip>
+#include "Value/ValueFormatter.hpp"
+#include "Value/Variant.hpp"
 #include <stdexcept>
 
 namespace FusioCore {
@@ -16,9 +16,7 @@ void Scalar::setValue(double value) {
 }
 
 std::string Scalar::toString() const {
-    std::ostringstream oss;
-    oss << std::fixed << std::setprecision(6) << value_;
-    return oss.str();
+    return ValueFormatter::getInstance().toString(Value(*this));
 }
 
 Scalar Scalar::operator+(const Scalar& other) const {
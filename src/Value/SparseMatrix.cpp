@@ -0,0 +1,243 @@
+#include "Value/SparseMatrix.hpp"
+#include "Value/ValueFormatter.hpp"
+#include "Value/Variant.hpp"
+#include <charconv>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+namespace FusioCore {
+
+namespace {
+
+std::string dimensions(const SparseMatrix::Storage& data) {
+    return std::to_string(data.rows()) + "x" + std::to_string(data.cols());
+}
+
+void requireSameDimensions(const SparseMatrix::Storage& a, const SparseMatrix::Storage& b, const char* operation) {
+    if (a.rows() != b.rows() || a.cols() != b.cols()) {
+        throw std::runtime_error(std::string("Dimensions incompatibles pour ") + operation + " : " +
+                                 dimensions(a) + " et " + dimensions(b));
+    }
+}
+
+// Nombre d'un message d'erreur, écriture la plus courte
+std::string number(double value) {
+    char buffer[32];
+    return std::string(buffer, std::to_chars(buffer, buffer + sizeof(buffer), value).ptr);
+}
+
+} // namespace
+
+SparseMatrix::SparseMatrix(Storage data) : data_(std::make_shared<Storage>(std::move(data))) {
+    data_->makeCompressed();
+}
+
+SparseMatrix::SparseMatrix(Eigen::Index rows, Eigen::Index cols, const std::vector<Triplet>& triplets)
+    : data_(std::make_shared<Storage>(rows, cols)) {
+    for (const Triplet& triplet : triplets) {
+        if (triplet.row() < 0 || triplet.row() >= rows || triplet.col() < 0 || triplet.col() >= cols) {
+            throw std::runtime_error("Élément (" + std::to_string(triplet.row() + 1) + ", " +
+                                     std::to_string(triplet.col() + 1) + ") hors des dimensions " +
+                                     std::to_string(rows) + "x" + std::to_string(cols));
+        }
+    }
+    data_->setFromTriplets(triplets.begin(), triplets.end());
+}
+
+SparseMatrix::SparseMatrix(const Eigen::Ref<const Eigen::MatrixXd>& dense)
+    : data_(std::make_shared<Storage>(dense.sparseView())) {
+    data_->makeCompressed();
+}
+
+const SparseMatrix::Storage& SparseMatrix::getData() const {
+    return *data_;
+}
+
+SparseMatrix::Storage& SparseMatrix::getData() {
+    if (data_.use_count() > 1) {
+        data_ = std::make_shared<Storage>(*data_);
+    }
+    factorizations_ = Factorizations();
+    return *data_;
+}
+
+void SparseMatrix::setData(Storage data) {
+    factorizations_ = Factorizations();
+    data_ = std::make_shared<Storage>(std::move(data));
+    data_->makeCompressed();
+}
+
+size_t SparseMatrix::rows() const {
+    return static_cast<size_t>(data_->rows());
+}
+
+size_t SparseMatrix::cols() const {
+    return static_cast<size_t>(data_->cols());
+}
+
+size_t SparseMatrix::nonZeros() const {
+    return static_cast<size_t>(data_->nonZeros());
+}
+
+std::string SparseMatrix::toString() const {
+    return ValueFormatter::getInstance().toString(Value(*this));
+}
+
+SparseMatrix SparseMatrix::operator+(const SparseMatrix& other) const {
+    requireSameDimensions(*data_, *other.data_, "+");
+    return SparseMatrix(Storage(*data_ + *other.data_));
+}
+
+SparseMatrix SparseMatrix::operator-(const SparseMatrix& other) const {
+    requireSameDimensions(*data_, *other.data_, "-");
+    return SparseMatrix(Storage(*data_ - *other.data_));
+}
+
+SparseMatrix SparseMatrix::operator*(const SparseMatrix& other) const {
+    if (data_->cols() != other.data_->rows()) {
+        throw std::runtime_error("Dimensions incompatibles pour * : " + dimensions(*data_) + " et " +
+                                 dimensions(*other.data_));
+    }
+    return SparseMatrix(Storage(*data_ * *other.data_));
+}
+
+SparseMatrix SparseMatrix::operator*(const Scalar& scalar) const {
+    return SparseMatrix(Storage(*data_ * scalar.getValue()));
+}
+
+Matrix SparseMatrix::operator*(const Matrix& matrix) const {
+    if (data_->cols() != static_cast<Eigen::Index>(matrix.rows())) {
+        throw std::runtime_error("Dimensions incompatibles pour * : " + dimensions(*data_) + " et " +
+                                 std::to_string(matrix.rows()) + "x" + std::to_string(matrix.cols()));
+    }
+    return Matrix(*data_ * matrix.getData());
+}
+
+Vector SparseMatrix::operator*(const Vector& vector) const {
+    if (data_->cols() != vector.getData().size()) {
+        throw std::runtime_error("Dimensions incompatibles pour * : " + dimensions(*data_) + " et " +
+                                 std::to_string(vector.size()) + "x1");
+    }
+    return Vector(*data_ * vector.getData());
+}
+
+SparseMatrix SparseMatrix::transpose() const {
+    return SparseMatrix(Storage(data_->transpose()));
+}
+
+Matrix SparseMatrix::toDense() const {
+    return Matrix(Eigen::MatrixXd(*data_));
+}
+
+bool SparseMatrix::isSymmetric() const {
+    if (factorizations_.symmetric < 0) {
+        const bool square = data_->rows() == data_->cols();
+        factorizations_.symmetric = square && Storage(data_->transpose()).isApprox(*data_, 0.0) ? 1 : 0;
+    }
+    return factorizations_.symmetric == 1;
+}
+
+const Eigen::SimplicialLDLT<SparseMatrix::Storage>& SparseMatrix::ldlt() const {
+    requireSquare("La décomposition LDLᵀ");
+    if (!factorizations_.ldlt) {
+        factorizations_.ldlt = std::make_shared<const Eigen::SimplicialLDLT<Storage>>(*data_);
+    }
+    return *factorizations_.ldlt;
+}
+
+const Eigen::SparseLU<SparseMatrix::Storage>& SparseMatrix::lu() const {
+    requireSquare("La décomposition LU");
+    if (!factorizations_.lu) {
+        auto lu = std::make_shared<Eigen::SparseLU<Storage>>();
+        lu->analyzePattern(*data_);
+        lu->factorize(*data_);
+        factorizations_.lu = std::move(lu);
+    }
+    return *factorizations_.lu;
+}
+
+double SparseMatrix::determinant() const {
+    const Eigen::SparseLU<Storage>& decomposition = lu();
+    if (decomposition.info() != Eigen::Success) {
+        return 0.0;
+    }
+    // SparseLU::determinant() ne modifie pas la décomposition mais n'est pas déclarée const
+    return const_cast<Eigen::SparseLU<Storage>&>(decomposition).determinant();
+}
+
+Eigen::MatrixXd SparseMatrix::solve(const Eigen::Ref<const Eigen::MatrixXd>& rhs) const {
+    requireSquare("La résolution creuse");
+    if (rhs.rows() != data_->rows()) {
+        throw std::runtime_error("Dimensions incompatibles pour la résolution : " +
+                                 std::to_string(data_->rows()) + " lignes et " +
+                                 std::to_string(rhs.rows()) + " lignes");
+    }
+    
+    // LDLᵀ sans pivot : échoue sur certaines matrices symétriques indéfinies, LU prend alors le relais
+    if (isSymmetric() && ldlt().info() == Eigen::Success) {
+        return ldlt().solve(rhs);
+    }
+    if (lu().info() != Eigen::Success) {
+        throw std::runtime_error("Matrix is not invertible");
+    }
+    return lu().solve(rhs);
+}
+
+Eigen::VectorXd SparseMatrix::solveIterative(IterativeMethod method, const Eigen::Ref<const Eigen::VectorXd>& rhs,
+                                             double tolerance, Eigen::Index maxIterations) const {
+    requireSquare("La résolution itérative");
+    // !(x > 0) rejette aussi NaN
+    if (!(tolerance > 0.0) || !std::isfinite(tolerance)) {
+        throw std::runtime_error("La tolérance d'un solveur itératif doit être un réel strictement positif : " +
+                                 number(tolerance));
+    }
+    if (maxIterations < 0) {
+        throw std::runtime_error("Le nombre maximal d'itérations ne peut pas être négatif");
+    }
+    if (rhs.size() != data_->rows()) {
+        throw std::runtime_error("Dimensions incompatibles pour la résolution : " +
+                                 std::to_string(data_->rows()) + " lignes et " +
+                                 std::to_string(rhs.size()) + " lignes");
+    }
+    
+    auto run = [&](auto& solver) {
+        solver.setTolerance(tolerance);
+        if (maxIterations > 0) {
+            solver.setMaxIterations(maxIterations);
+        }
+        solver.compute(*data_);
+        Eigen::VectorXd x = solver.solve(rhs);
+        if (solver.info() != Eigen::Success) {
+            throw std::runtime_error("Le solveur itératif n'a pas convergé (" + std::to_string(solver.iterations()) +
+                                     " itérations, erreur relative " + std::to_string(solver.error()) + ")");
+        }
+        return x;
+    };
+    
+    if (method == IterativeMethod::ConjugateGradient) {
+        // Lower | Upper : produit avec la matrice complète, parallélisé par Eigen
+        Eigen::ConjugateGradient<Storage, Eigen::Lower | Eigen::Upper> solver;
+        return run(solver);
+    }
+    Eigen::BiCGSTAB<Storage> solver;
+    return run(solver);
+}
+
+Eigen::Index SparseMatrix::iterationLimit(double value) {
+    if (!(value >= 1.0) || value > static_cast<double>(std::numeric_limits<int>::max()) ||
+        value != std::floor(value)) {
+        throw std::runtime_error("Le nombre maximal d'itérations doit être un entier strictement positif : " +
+                                 number(value));
+    }
+    return static_cast<Eigen::Index>(value);
+}
+
+void SparseMatrix::requireSquare(const char* operation) const {
+    if (data_->rows() != data_->cols()) {
+        throw std::runtime_error(std::string(operation) + " requiert une matrice carrée (" + dimensions(*data_) + ")");
+    }
+}
+
+} // namespace FusioCore
@@ -0,0 +1,247 @@
+#include "Value/ValueFormatter.hpp"
+#include "Value/Variant.hpp"
+#include <charconv>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace FusioCore {
+
+namespace {
+
+// Indice marquant l'ellipse d'un résumé
+constexpr Eigen::Index ELLIPSIS = -1;
+
+/**
+ * Tampon de sortie : les nombres sont écrits en place par std::to_chars et
+ * le contenu est transmis par blocs au flux (ou à la chaîne) de destination
+ */
+class Sink {
+public:
+    Sink(std::ostream& out, const FormatOptions& options) : out_(&out), options_(options) {}
+    Sink(std::string& text, const FormatOptions& options) : text_(&text), options_(options) {}
+    
+    void put(const char* text) {
+        const size_t length = std::strlen(text);
+        reserve(length);
+        std::memcpy(buffer_ + size_, text, length);
+        size_ += length;
+    }
+    
+    // Un entier est écrit tel quel, un float dans sa propre précision (1.1 et non 1.100000023841858)
+    template <typename T>
+    void number(T value) {
+        reserve(MAX_NUMBER_LENGTH);
+        char* first = buffer_ + size_;
+        char* last = buffer_ + CAPACITY;
+        std::to_chars_result result;
+        if constexpr (std::is_integral_v<T>) {
+            result = std::to_chars(first, last, value);
+        } else {
+            result = options_.format == NumberFormat::Fixed
+                ? std::to_chars(first, last, value, std::chars_format::fixed, options_.precision)
+                : std::to_chars(first, last, value);
+        }
+        size_ = static_cast<size_t>(result.ptr - buffer_);
+    }
+    
+    void flush() {
+        if (text_) {
+            text_->append(buffer_, size_);
+        } else {
+            out_->write(buffer_, static_cast<std::streamsize>(size_));
+        }
+        size_ = 0;
+    }
+
+private:
+    static constexpr size_t CAPACITY = 8192;
+    
+    // 309 chiffres avant la virgule (1e308), signe, point et décimales
+    static constexpr size_t MAX_NUMBER_LENGTH = 312 + ValueFormatter::MAX_PRECISION;
+    
+    void reserve(size_t length) {
+        if (size_ + length > CAPACITY) {
+            flush();
+        }
+    }
+    
+    std::ostream* out_ = nullptr;
+    std::string* text_ = nullptr;
+    const FormatOptions& options_;
+    char buffer_[CAPACITY];
+    size_t size_ = 0;
+};
+
+// Indices affichés parmi [0, n) : tous, ou les edge premiers et derniers séparés par ELLIPSIS
+std::vector<Eigen::Index> shownIndices(Eigen::Index n, bool summarize, Eigen::Index edge) {
+    std::vector<Eigen::Index> indices;
+    if (!summarize || n <= 2 * edge) {
+        for (Eigen::Index i = 0; i < n; ++i) {
+            indices.push_back(i);
+        }
+        return indices;
+    }
+    for (Eigen::Index i = 0; i < edge; ++i) {
+        indices.push_back(i);
+    }
+    indices.push_back(ELLIPSIS);
+    for (Eigen::Index i = n - edge; i < n; ++i) {
+        indices.push_back(i);
+    }
+    return indices;
+}
+
+// Dimensions d'une valeur résumée et type des éléments s'il n'est pas double : " (1000x8, single)"
+void writeSuffix(Sink& sink, const std::string& dimensions, bool summarize, DType dtype) {
+    if (summarize && dtype != DType::F64) {
+        sink.put((" (" + dimensions + ", " + dtypeName(dtype) + ")").c_str());
+    } else if (summarize) {
+        sink.put((" (" + dimensions + ")").c_str());
+    } else if (dtype != DType::F64) {
+        sink.put((std::string(" (") + dtypeName(dtype) + ")").c_str());
+    }
+}
+
+template <typename Elements>
+void writeVector(Sink& sink, const Elements& data, DType dtype, const FormatOptions& options) {
+    const bool summarize = !options.full && data.size() > options.threshold;
+    sink.put("[");
+    bool first = true;
+    for (Eigen::Index i : shownIndices(data.size(), summarize, options.edgeItems)) {
+        if (!first) {
+            sink.put(", ");
+        }
+        first = false;
+        if (i == ELLIPSIS) {
+            sink.put("...");
+        } else {
+            sink.number(data(i));
+        }
+    }
+    sink.put("]");
+    writeSuffix(sink, std::to_string(data.size()), summarize, dtype);
+}
+
+template <typename Elements>
+void writeMatrix(Sink& sink, const Elements& data, DType dtype, const FormatOptions& options) {
+    const bool summarize = !options.full && data.size() > options.threshold;
+    const std::vector<Eigen::Index> rows = shownIndices(data.rows(), summarize, options.edgeItems);
+    const std::vector<Eigen::Index> cols = shownIndices(data.cols(), summarize, options.edgeItems);
+    sink.put("[");
+    for (size_t r = 0; r < rows.size(); ++r) {
+        if (r > 0) {
+            sink.put("; ");
+        }
+        if (rows[r] == ELLIPSIS) {
+            sink.put("...");
+            continue;
+        }
+        for (size_t c = 0; c < cols.size(); ++c) {
+            if (c > 0) {
+                sink.put(" ");
+            }
+            if (cols[c] == ELLIPSIS) {
+                sink.put("...");
+            } else {
+                sink.number(data(rows[r], cols[c]));
+            }
+        }
+    }
+    sink.put("]");
+    writeSuffix(sink, std::to_string(data.rows()) + "x" + std::to_string(data.cols()), summarize, dtype);
+}
+
+// Éléments non nuls "(ligne, colonne) valeur" en ordre colonne, suivis des dimensions
+void writeSparse(Sink& sink, const SparseMatrix::Storage& data, const FormatOptions& options) {
+    const Eigen::Index count = data.nonZeros();
+    const bool summarize = !options.full && count > options.threshold;
+    const std::vector<Eigen::Index> shown = shownIndices(count, summarize, options.edgeItems);
+    
+    size_t next = 0;
+    Eigen::Index k = 0;
+    auto separate = [&]() {
+        if (next > 0) {
+            sink.put("; ");
+        }
+    };
+    sink.put("[");
+    for (Eigen::Index col = 0; col < data.outerSize() && next < shown.size(); ++col) {
+        for (SparseMatrix::Storage::InnerIterator it(data, col); it && next < shown.size(); ++it, ++k) {
+            if (shown[next] == ELLIPSIS) {
+                separate();
+                sink.put("...");
+                ++next;
+            }
+            if (shown[next] == k) {
+                separate();
+                sink.put(("(" + std::to_string(it.row() + 1) + ", " + std::to_string(col + 1) + ") ").c_str());
+                sink.number(it.value());
+                ++next;
+            }
+        }
+    }
+    sink.put(("] (" + std::to_string(data.rows()) + "x" + std::to_string(data.cols()) + " creuse, " +
+              std::to_string(count) + " non nuls)").c_str());
+}
+
+void writeValue(Sink& sink, const Value& value, const FormatOptions& options) {
+    value.visit([&](const auto& alternative) {
+        using T = std::decay_t<decltype(alternative)>;
+        if constexpr (std::is_same_v<T, Scalar>) {
+            sink.number(alternative.getValue());
+        } else if constexpr (std::is_same_v<T, Vector> || std::is_same_v<T, Matrix>) {
+            // Éléments lus dans leur type, sans conversion en double
+            dispatch(alternative.dtype(), [&](auto tag) {
+                using Element = typename decltype(tag)::type;
+                if constexpr (std::is_same_v<T, Vector>) {
+                    writeVector(sink, alternative.template getTypedData<Element>(), alternative.dtype(), options);
+                } else {
+                    writeMatrix(sink, alternative.template getTypedData<Element>(), alternative.dtype(), options);
+                }
+            });
+        } else if constexpr (std::is_same_v<T, SparseMatrix>) {
+            writeSparse(sink, alternative.getData(), options);
+        } else {
+            throw std::runtime_error("Type de valeur non supporté pour l'affichage");
+        }
+    });
+    sink.flush();
+}
+
+} // namespace
+
+ValueFormatter& ValueFormatter::getInstance() {
+    static ValueFormatter instance;
+    return instance;
+}
+
+const FormatOptions& ValueFormatter::getOptions() const {
+    return options_;
+}
+
+void ValueFormatter::setOptions(const FormatOptions& options) {
+    if (options.precision < 0 || options.precision > MAX_PRECISION) {
+        throw std::runtime_error("Précision invalide : " + std::to_string(options.precision) +
+                                 " (de 0 à " + std::to_string(MAX_PRECISION) + ")");
+    }
+    if (options.threshold < 0 || options.edgeItems < 1) {
+        throw std::runtime_error("Seuils d'affichage invalides");
+    }
+    options_ = options;
+}
+
+void ValueFormatter::write(std::ostream& out, const Value& value) const {
+    Sink sink(out, options_);
+    writeValue(sink, value, options_);
+}
+
+std::string ValueFormatter::toString(const Value& value) const {
+    std::string text;
+    Sink sink(text, options_);
+    writeValue(sink, value, options_);
+    return text;
+}
+
+} // namespace FusioCore
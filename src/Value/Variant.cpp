@@ -0,0 +1,102 @@
+#include "Value/Variant.hpp"
+#include "Value/ValueFormatter.hpp"
+#include <type_traits>
+
+namespace FusioCore {
+
+namespace {
+
+template <typename T>
+const char* nameOf() {
+    if constexpr (std::is_same_v<T, Scalar>) {
+        return "scalaire";
+    } else if constexpr (std::is_same_v<T, Vector>) {
+        return "vecteur";
+    } else if constexpr (std::is_same_v<T, Matrix>) {
+        return "matrice";
+    } else if constexpr (std::is_same_v<T, SparseMatrix>) {
+        return "matrice creuse";
+    } else {
+        return "vide";
+    }
+}
+
+// Opération applicable à des opérandes de types A et B (opérateur existant)
+template <typename Operation, typename A, typename B, typename = void>
+struct Applicable : std::false_type {};
+template <typename Operation, typename A, typename B>
+struct Applicable<Operation, A, B, std::void_t<std::invoke_result_t<Operation, const A&, const B&>>>
+    : std::true_type {};
+
+struct Add {
+    template <typename A, typename B>
+    auto operator()(const A& a, const B& b) const -> decltype(a + b) { return a + b; }
+};
+
+struct Subtract {
+    template <typename A, typename B>
+    auto operator()(const A& a, const B& b) const -> decltype(a - b) { return a - b; }
+};
+
+struct Multiply {
+    template <typename A, typename B>
+    auto operator()(const A& a, const B& b) const -> decltype(a * b) { return a * b; }
+
+    // Scalaire à gauche : les types ne définissent que le produit par un scalaire à droite
+    template <typename B, typename = std::enable_if_t<!std::is_same_v<B, Scalar>>>
+    auto operator()(const Scalar& a, const B& b) const -> decltype(b * a) { return b * a; }
+};
+
+struct Divide {
+    template <typename A, typename B>
+    auto operator()(const A& a, const B& b) const -> decltype(a / b) { return a / b; }
+};
+
+// Double répartition : une seule visite sur les deux alternatives
+template <typename Operation>
+Value apply(const Value& lhs, const Value& rhs, Operation operation, const char* symbol) {
+    return std::visit([&](const auto& a, const auto& b) -> Value {
+        using A = std::decay_t<decltype(a)>;
+        using B = std::decay_t<decltype(b)>;
+        if constexpr (Applicable<Operation, A, B>::value) {
+            return operation(a, b);
+        } else {
+            throw std::runtime_error(std::string("Opération ") + symbol + " non définie entre " + nameOf<A>() +
+                                     " et " + nameOf<B>());
+        }
+    }, lhs.storage(), rhs.storage());
+}
+
+} // namespace
+
+Value Value::copy() const {
+    Value result;
+    result.storage_ = storage_;
+    return result;
+}
+
+const char* Value::typeName() const {
+    return visit([](const auto& value) { return nameOf<std::decay_t<decltype(value)>>(); });
+}
+
+std::string Value::toString() const {
+    return ValueFormatter::getInstance().toString(*this);
+}
+
+Value Value::add(const Value& lhs, const Value& rhs) {
+    return apply(lhs, rhs, Add(), "+");
+}
+
+Value Value::subtract(const Value& lhs, const Value& rhs) {
+    return apply(lhs, rhs, Subtract(), "-");
+}
+
+Value Value::multiply(const Value& lhs, const Value& rhs) {
+    return apply(lhs, rhs, Multiply(), "*");
+}
+
+Value Value::divide(const Value& lhs, const Value& rhs) {
+    return apply(lhs, rhs, Divide(), "/");
+}
+
+} // namespace FusioCore
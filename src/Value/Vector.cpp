@@ -1,54 +1,184 @@
 #include "Value/Value.hpp"
-#include <sstream>
-#include <iomanip>
+#include "Value/ValueFormatter.hpp"
+#include "Value/Variant.hpp"
+#include <stdexcept>
+#include <utility>
 
 namespace FusioCore {
 
-Vector::Vector(const Eigen::VectorXd& data) : data_(data) {}
+Vector::Vector(Eigen::VectorXd data) : data_(std::make_shared<Eigen::VectorXd>(std::move(data))) {}
 
-Vector::Vector(size_t size, double defaultValue) : data_(Eigen::VectorXd::Constant(size, defaultValue)) {}
+Vector::Vector(size_t size, double defaultValue)
+    : data_(std::make_shared<Eigen::VectorXd>(Eigen::VectorXd::Constant(size, defaultValue))) {}
 
-const Eigen::VectorXd& Vector::getData() const {
-    return data_;
+template <typename T>
+Vector::Vector(VectorOf<T> data) {
+    auto elements = std::make_shared<const VectorOf<T>>(std::move(data));
+    typed_.dtype = DTypeOf<T>::value;
+    typed_.data = elements->data();
+    typed_.size = elements->size();
+    typed_.owner = std::move(elements);
+}
+
+template Vector::Vector(VectorOf<float>);
+template Vector::Vector(VectorOf<int32_t>);
+template Vector::Vector(VectorOf<int64_t>);
+
+template <typename T>
+Vector::Vector(const T* data, Eigen::Index size, std::shared_ptr<const void> owner) {
+    if constexpr (std::is_same_v<T, double>) {
+        external_.data = data;
+        external_.size = size;
+        external_.owner = std::move(owner);
+    } else {
+        typed_.dtype = DTypeOf<T>::value;
+        typed_.data = data;
+        typed_.size = size;
+        typed_.owner = std::move(owner);
+    }
+}
+
+template Vector::Vector(const double*, Eigen::Index, std::shared_ptr<const void>);
+template Vector::Vector(const float*, Eigen::Index, std::shared_ptr<const void>);
+template Vector::Vector(const int32_t*, Eigen::Index, std::shared_ptr<const void>);
+template Vector::Vector(const int64_t*, Eigen::Index, std::shared_ptr<const void>);
+
+Eigen::Ref<const Eigen::VectorXd> Vector::getData() const {
+    if (typed_.data) {
+        if (!typed_.widened) {
+            typed_.widened = std::make_shared<const Eigen::VectorXd>(elementsAs<double>());
+        }
+        return *typed_.widened;
+    }
+    return view();
 }
 
 Eigen::VectorXd& Vector::getData() {
-    return data_;
+    if (typed_.data) {
+        data_ = std::make_shared<Eigen::VectorXd>(std::as_const(*this).getData());
+        typed_ = Typed();
+    } else if (external_.data) {
+        // Éléments externes jamais modifiés : copiés à la première écriture
+        data_ = std::make_shared<Eigen::VectorXd>(view());
+        external_ = External();
+    }
+    // Copie à l'écriture : les autres copies gardent les anciens éléments
+    if (data_.use_count() > 1) {
+        data_ = std::make_shared<Eigen::VectorXd>(*data_);
+    }
+    return *data_;
 }
 
-void Vector::setData(const Eigen::VectorXd& data) {
-    data_ = data;
+void Vector::setData(Eigen::VectorXd data) {
+    typed_ = Typed();
+    external_ = External();
+    data_ = std::make_shared<Eigen::VectorXd>(std::move(data));
 }
 
 size_t Vector::size() const {
-    return static_cast<size_t>(data_.size());
+    return static_cast<size_t>(typed_.data ? typed_.size : view().size());
 }
 
-std::string Vector::toString() const {
-    std::ostringstream oss;
-    oss << "[";
-    for (int i = 0; i < data_.size(); ++i) {
-        if (i > 0) oss << ", ";
-        oss << std::fixed << std::setprecision(6) << data_(i);
+Eigen::Map<const Eigen::VectorXd> Vector::view() const {
+    if (external_.data) {
+        return Eigen::Map<const Eigen::VectorXd>(external_.data, external_.size);
     }
-    oss << "]";
-    return oss.str();
+    return Eigen::Map<const Eigen::VectorXd>(data_->data(), data_->size());
+}
+
+DType Vector::dtype() const {
+    return typed_.dtype;
+}
+
+template <typename T>
+Eigen::Map<const VectorOf<T>> Vector::getTypedData() const {
+    if (DTypeOf<T>::value != dtype()) {
+        throw std::runtime_error(std::string("Vecteur de type ") + dtypeName(dtype()) + " lu comme " +
+                                 dtypeName(DTypeOf<T>::value));
+    }
+    if constexpr (std::is_same_v<T, double>) {
+        return view();
+    } else {
+        return Eigen::Map<const VectorOf<T>>(static_cast<const T*>(typed_.data), typed_.size);
+    }
+}
+
+template Eigen::Map<const VectorOf<float>> Vector::getTypedData<float>() const;
+template Eigen::Map<const VectorOf<double>> Vector::getTypedData<double>() const;
+template Eigen::Map<const VectorOf<int32_t>> Vector::getTypedData<int32_t>() const;
+template Eigen::Map<const VectorOf<int64_t>> Vector::getTypedData<int64_t>() const;
+
+template <typename T>
+Eigen::Ref<const VectorOf<T>> Vector::elementsAs() const {
+    // Même type : cast<T>() est l'identité et la référence porte sur les éléments eux-mêmes
+    return dispatch(dtype(), [&](auto tag) -> Eigen::Ref<const VectorOf<T>> {
+        using Element = typename decltype(tag)::type;
+        return getTypedData<Element>().template cast<T>();
+    });
+}
+
+// Types de calcul (ComputeType), utilisés aussi par Matrix
+template Eigen::Ref<const VectorOf<float>> Vector::elementsAs<float>() const;
+template Eigen::Ref<const VectorOf<double>> Vector::elementsAs<double>() const;
+
+Vector Vector::astype(DType target) const {
+    if (target == dtype()) {
+        return *this;
+    }
+    return dispatch(target, [&](auto tag) {
+        using T = typename decltype(tag)::type;
+        if constexpr (std::is_same_v<T, double>) {
+            return Vector(Eigen::VectorXd(elementsAs<double>()));
+        } else {
+            // Conversion unique depuis le double (sans copie intermédiaire pour un vecteur double)
+            return Vector(narrowed<T>(elementsAs<double>()));
+        }
+    });
+}
+
+std::string Vector::toString() const {
+    return ValueFormatter::getInstance().toString(Value(*this));
 }
 
 Vector Vector::operator+(const Vector& other) const {
-    return Vector(data_ + other.data_);
+    if (!typed_.data && !other.typed_.data) {
+        return Vector(Eigen::VectorXd(view() + other.view()));
+    }
+    return dispatch(promote(dtype(), other.dtype()), [&](auto tag) {
+        using T = typename decltype(tag)::type;
+        using C = ComputeType<T>;
+        return Vector(saturated<T>(elementsAs<C>() + other.elementsAs<C>()));
+    });
 }
 
 Vector Vector::operator-(const Vector& other) const {
-    return Vector(data_ - other.data_);
+    if (!typed_.data && !other.typed_.data) {
+        return Vector(Eigen::VectorXd(view() - other.view()));
+    }
+    return dispatch(promote(dtype(), other.dtype()), [&](auto tag) {
+        using T = typename decltype(tag)::type;
+        using C = ComputeType<T>;
+        return Vector(saturated<T>(elementsAs<C>() - other.elementsAs<C>()));
+    });
 }
 
 Scalar Vector::operator*(const Vector& other) const {
-    return Scalar(data_.dot(other.data_));
+    if (!typed_.data && !other.typed_.data) {
+        return Scalar(view().dot(other.view()));
+    }
+    // Produit scalaire en double, quel que soit le type des éléments
+    return Scalar(elementsAs<double>().dot(other.elementsAs<double>()));
 }
 
 Vector Vector::operator*(const Scalar& scalar) const {
-    return Vector(data_ * scalar.getValue());
+    if (!typed_.data) {
+        return Vector(Eigen::VectorXd(view() * scalar.getValue()));
+    }
+    return dispatch(dtype(), [&](auto tag) {
+        using T = typename decltype(tag)::type;
+        using C = ComputeType<T>;
+        return Vector(narrowed<T>(getTypedData<T>().template cast<C>() * static_cast<C>(scalar.getValue())));
+    });
 }
 
-} // namespace FusioCore 
\ No newline at end of file
+} // namespace FusioCore
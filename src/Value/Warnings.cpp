@@ -0,0 +1,22 @@
+#include "Value/Warnings.hpp"
+#include <utility>
+
+namespace FusioCore {
+
+namespace {
+
+thread_local std::vector<std::string> pending;
+
+} // namespace
+
+void Warnings::report(std::string message) {
+    pending.push_back(std::move(message));
+}
+
+std::vector<std::string> Warnings::take() {
+    std::vector<std::string> messages;
+    messages.swap(pending);
+    return messages;
+}
+
+} // namespace FusioCore